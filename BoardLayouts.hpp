@@ -0,0 +1,263 @@
+#ifndef BOARD_LAYOUTS_HPP
+#define BOARD_LAYOUTS_HPP
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+// =======================================================
+// LAYOUTS DO TABULEIRO (DADOS EM TEMPO DE COMPILAÇÃO)
+// =======================================================
+// Cada layout é um tipo com os buracos em constexpr. Board<Layout> gera,
+// em tempo de compilação, a grade de baldes espaciais usada no teste de
+// clique e desenrola os loops sobre os buracos para cada layout.
+
+enum BoardLayoutId {
+    LAYOUT_CLASSIC,
+    LAYOUT_GRID_4X4,
+    LAYOUT_GRID_5X5,
+    LAYOUT_ARENA,
+    LAYOUT_COUNT
+};
+
+struct HolePoint {
+    float x;
+    float y;
+};
+
+// Área lógica usada pelas grades (no gramado, abaixo do horizonte)
+constexpr float BOARD_LEFT = 80.0f;
+constexpr float BOARD_TOP = 250.0f;
+constexpr float BOARD_WIDTH = 864.0f;
+constexpr float BOARD_HEIGHT = 760.0f;
+
+// Buraco desenhado pelos layouts com DRAW_HOLES: elipse com semi-eixos
+// 0.8R x 0.4R, centrada 0.5R abaixo do centro da capivara.
+constexpr float HOLE_RADIUS_RATIO = 0.8f;
+constexpr float HOLE_SQUASH = 0.5f;
+constexpr float HOLE_OFFSET_RATIO = 0.5f;
+
+// Horizonte do gramado de fundoGAME.png: y = 264 no centro, descendo ~37 px
+// até as bordas.
+constexpr float grassHorizonY(float x)
+{
+    return 264.0f + (x - 512.0f) * (x - 512.0f) / (2.0f * 3561.0f);
+}
+
+template <int Rows, int Cols>
+constexpr std::array<HolePoint, Rows * Cols> makeGridHoles()
+{
+    std::array<HolePoint, Rows * Cols> points{};
+    for (int r = 0; r < Rows; ++r) {
+        for (int c = 0; c < Cols; ++c) {
+            points[r * Cols + c] = HolePoint{BOARD_LEFT + (c + 0.5f) * BOARD_WIDTH / Cols,
+                                             BOARD_TOP + (r + 0.5f) * BOARD_HEIGHT / Rows};
+        }
+    }
+    return points;
+}
+
+// Layout original de 9 buracos, alinhado com a arte de fundoGAME.png.
+struct ClassicLayout {
+    static constexpr const char* NAME = "CLASSICO";
+    static constexpr float MOLE_RADIUS = 115.0f;
+    static constexpr bool DRAW_HOLES = false;
+    static constexpr float OFFSET = 115.0f;
+    static constexpr std::array<HolePoint, 9> HOLES = {{
+        {56.0f + OFFSET, 155.0f + OFFSET},  // B1
+        {413.0f + OFFSET, 132.0f + OFFSET}, // B2
+        {746.0f + OFFSET, 142.0f + OFFSET}, // B3
+        {230.0f + OFFSET, 276.0f + OFFSET}, // B4
+        {620.0f + OFFSET, 298.0f + OFFSET}, // B5
+        {415.0f + OFFSET, 473.0f + OFFSET}, // B6
+        {71.0f + OFFSET, 623.0f + OFFSET},  // B7
+        {388.0f + OFFSET, 721.0f + OFFSET}, // B8
+        {720.0f + OFFSET, 605.0f + OFFSET}  // B9
+    }};
+};
+
+struct Grid4x4Layout {
+    static constexpr const char* NAME = "GRADE 4x4";
+    static constexpr float MOLE_RADIUS = 90.0f;
+    static constexpr bool DRAW_HOLES = true;
+    static constexpr std::array<HolePoint, 16> HOLES = makeGridHoles<4, 4>();
+};
+
+struct Grid5x5Layout {
+    static constexpr const char* NAME = "GRADE 5x5";
+    static constexpr float MOLE_RADIUS = 72.0f;
+    static constexpr bool DRAW_HOLES = true;
+    static constexpr std::array<HolePoint, 25> HOLES = makeGridHoles<5, 5>();
+};
+
+// Anel de 8 buracos (raio 300 em volta de 512,600), um no centro e 4 nos cantos.
+struct ArenaLayout {
+    static constexpr const char* NAME = "ARENA";
+    static constexpr float MOLE_RADIUS = 90.0f;
+    static constexpr bool DRAW_HOLES = true;
+    static constexpr std::array<HolePoint, 13> HOLES = {{
+        {512.0f, 600.0f},
+        {812.0f, 600.0f}, {724.1f, 812.1f}, {512.0f, 900.0f}, {299.9f, 812.1f},
+        {212.0f, 600.0f}, {299.9f, 387.9f}, {512.0f, 300.0f}, {724.1f, 387.9f},
+        {115.0f, 330.0f}, {909.0f, 330.0f}, {115.0f, 930.0f}, {909.0f, 930.0f}
+    }};
+};
+
+// Verdadeiro se os buracos desenhados do layout ficam inteiros no gramado:
+// a borda de cima abaixo do horizonte (a parábola é convexa, então basta
+// testar as duas pontas) e a de baixo dentro da tela.
+template <typename Layout>
+constexpr bool holesOnGrass()
+{
+    if (!Layout::DRAW_HOLES) return true;
+
+    const float R = Layout::MOLE_RADIUS;
+    for (std::size_t i = 0; i < Layout::HOLES.size(); ++i) {
+        float top = Layout::HOLES[i].y + (HOLE_OFFSET_RATIO - HOLE_RADIUS_RATIO * HOLE_SQUASH) * R;
+        float bottom = Layout::HOLES[i].y + (HOLE_OFFSET_RATIO + HOLE_RADIUS_RATIO * HOLE_SQUASH) * R;
+        float leftHorizon = grassHorizonY(Layout::HOLES[i].x - HOLE_RADIUS_RATIO * R);
+        float rightHorizon = grassHorizonY(Layout::HOLES[i].x + HOLE_RADIUS_RATIO * R);
+        if (top < leftHorizon || top < rightHorizon || bottom > 1024.0f) return false; // 1024 = altura da tela
+    }
+    return true;
+}
+
+// =======================================================
+// BALDES ESPACIAIS
+// =======================================================
+// A tela lógica (1024x1024) é dividida em 8x8 células. Cada célula guarda os
+// buracos cujo círculo de clique encosta nela, então um clique só testa os
+// poucos buracos da sua célula.
+const int BUCKET_COLS = 8;
+const int BUCKET_ROWS = 8;
+const float BUCKET_WIDTH = 1024.0f / BUCKET_COLS;
+const float BUCKET_HEIGHT = 1024.0f / BUCKET_ROWS;
+const int MAX_HOLES_PER_BUCKET = 6;
+
+struct HoleBucket {
+    int count;
+    int index[MAX_HOLES_PER_BUCKET];
+};
+
+struct BucketGrid {
+    HoleBucket cells[BUCKET_ROWS * BUCKET_COLS];
+    bool overflow;
+};
+
+constexpr float clampFloat(float v, float lo, float hi)
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+template <typename Layout>
+constexpr BucketGrid buildBuckets()
+{
+    BucketGrid grid{};
+    for (int cell = 0; cell < BUCKET_ROWS * BUCKET_COLS; ++cell) {
+        float left = (cell % BUCKET_COLS) * BUCKET_WIDTH;
+        float top = (cell / BUCKET_COLS) * BUCKET_HEIGHT;
+
+        for (int i = 0; i < static_cast<int>(Layout::HOLES.size()); ++i) {
+            // Ponto da célula mais próximo do centro do buraco
+            float nearestX = clampFloat(Layout::HOLES[i].x, left, left + BUCKET_WIDTH);
+            float nearestY = clampFloat(Layout::HOLES[i].y, top, top + BUCKET_HEIGHT);
+            float dx = nearestX - Layout::HOLES[i].x;
+            float dy = nearestY - Layout::HOLES[i].y;
+            if (dx * dx + dy * dy > Layout::MOLE_RADIUS * Layout::MOLE_RADIUS) continue;
+
+            HoleBucket& bucket = grid.cells[cell];
+            if (bucket.count == MAX_HOLES_PER_BUCKET) {
+                grid.overflow = true;
+                continue;
+            }
+            bucket.index[bucket.count++] = i;
+        }
+    }
+    return grid;
+}
+
+// =======================================================
+// TABULEIRO ESPECIALIZADO POR LAYOUT
+// =======================================================
+template <typename Layout>
+struct Board {
+    typedef Layout LayoutType;
+
+    static constexpr int NUM_HOLES = static_cast<int>(Layout::HOLES.size());
+    static constexpr float MOLE_RADIUS = Layout::MOLE_RADIUS;
+    static constexpr BucketGrid BUCKETS = buildBuckets<Layout>();
+
+    static_assert(!BUCKETS.overflow, "Aumente MAX_HOLES_PER_BUCKET para este layout");
+    static_assert(holesOnGrass<Layout>(), "Buraco do layout fora do gramado de fundoGAME.png");
+
+    static sf::Vector2f position(int i)
+    {
+        return sf::Vector2f(Layout::HOLES[i].x, Layout::HOLES[i].y);
+    }
+
+    // fn(i, posição) para cada buraco, com o loop desenrolado.
+    template <typename Fn>
+    static void forEachHole(Fn&& fn)
+    {
+        forEachHoleUnrolled(fn, std::make_index_sequence<NUM_HOLES>());
+    }
+
+    // fn(i) para cada buraco cujo círculo contém o ponto.
+    template <typename Fn>
+    static void forEachHit(const sf::Vector2f& point, Fn&& fn)
+    {
+        if (point.x < 0.0f || point.y < 0.0f) return;
+
+        int col = static_cast<int>(point.x / BUCKET_WIDTH);
+        int row = static_cast<int>(point.y / BUCKET_HEIGHT);
+        if (col >= BUCKET_COLS || row >= BUCKET_ROWS) return;
+
+        const HoleBucket& bucket = BUCKETS.cells[row * BUCKET_COLS + col];
+        for (int k = 0; k < bucket.count; ++k) {
+            const HolePoint& hole = Layout::HOLES[bucket.index[k]];
+            float dx = point.x - hole.x;
+            float dy = point.y - hole.y;
+            if (dx * dx + dy * dy <= MOLE_RADIUS * MOLE_RADIUS) {
+                fn(bucket.index[k]);
+            }
+        }
+    }
+
+private:
+    template <typename Fn, std::size_t... I>
+    static void forEachHoleUnrolled(Fn& fn, std::index_sequence<I...>)
+    {
+        (fn(static_cast<int>(I), position(static_cast<int>(I))), ...);
+    }
+};
+
+// Escolhe a especialização do layout em tempo de execução:
+// fn(Board<...>()) com o tipo certo para o id.
+template <typename Fn>
+void withBoard(BoardLayoutId layout, Fn&& fn)
+{
+    switch (layout) {
+        case LAYOUT_GRID_4X4: fn(Board<Grid4x4Layout>()); break;
+        case LAYOUT_GRID_5X5: fn(Board<Grid5x5Layout>()); break;
+        case LAYOUT_ARENA:    fn(Board<ArenaLayout>());   break;
+        case LAYOUT_CLASSIC:
+        default:              fn(Board<ClassicLayout>()); break;
+    }
+}
+
+inline const char* boardLayoutName(BoardLayoutId layout)
+{
+    const char* name = "";
+    withBoard(layout, [&](auto board) { name = decltype(board)::LayoutType::NAME; });
+    return name;
+}
+
+inline float boardMoleRadius(BoardLayoutId layout)
+{
+    float radius = 0.0f;
+    withBoard(layout, [&](auto board) { radius = decltype(board)::MOLE_RADIUS; });
+    return radius;
+}
+
+#endif // BOARD_LAYOUTS_HPP
@@ -0,0 +1,216 @@
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <thread>
+
+using namespace std;
+
+const char* frameModeName(FrameMode mode)
+{
+    switch (mode) {
+        case FRAME_60HZ:     return "60 Hz";
+        case FRAME_120HZ:    return "120 Hz";
+        case FRAME_144HZ:    return "144 Hz";
+        case FRAME_VSYNC:    return "VSync";
+        case FRAME_UNCAPPED: return "Sem limite";
+        default:             return "?";
+    }
+}
+
+bool parseFrameMode(const string& value, FrameMode& mode)
+{
+    if (value == "60")            { mode = FRAME_60HZ;     return true; }
+    if (value == "120")           { mode = FRAME_120HZ;    return true; }
+    if (value == "144")           { mode = FRAME_144HZ;    return true; }
+    if (value == "vsync")         { mode = FRAME_VSYNC;    return true; }
+    if (value == "uncapped")      { mode = FRAME_UNCAPPED; return true; }
+    return false;
+}
+
+static int frameModeHz(FrameMode mode)
+{
+    switch (mode) {
+        case FRAME_60HZ:  return 60;
+        case FRAME_120HZ: return 120;
+        case FRAME_144HZ: return 144;
+        default:          return 0;
+    }
+}
+
+// Margem mínima e máxima reservada para o giro final após o sleep.
+static const chrono::microseconds MIN_SLEEP_MARGIN(1000);
+static const chrono::microseconds MAX_SLEEP_MARGIN(4000);
+
+FramePacer::FramePacer()
+    : mode(FRAME_60HZ),
+      targetPeriod(Clock::duration::zero()),
+      sleepMargin(chrono::microseconds(2000)),
+      lastFrameMs(0.0f),
+      lastWorkMs(0.0f),
+      vsyncSampleCount(0),
+      vsyncIntervalMs(0.0f)
+{
+    lastFrameStart = Clock::now();
+    workStart = lastFrameStart;
+    nextDeadline = lastFrameStart;
+    resetHistogram();
+}
+
+void FramePacer::setMode(FrameMode newMode, sf::RenderWindow& window)
+{
+    mode = newMode;
+
+    // O limite do SFML fica sempre desligado: quem controla o ritmo é o pacer.
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(mode == FRAME_VSYNC);
+
+    int hz = frameModeHz(mode);
+    if (hz > 0) {
+        targetPeriod = chrono::duration_cast<Clock::duration>(chrono::duration<double>(1.0 / hz));
+    } else {
+        targetPeriod = Clock::duration::zero();
+    }
+
+    lastFrameStart = Clock::now();
+    workStart = lastFrameStart;
+    nextDeadline = lastFrameStart + targetPeriod;
+    vsyncSampleCount = 0;
+    resetHistogram();
+}
+
+float FramePacer::getFrameBudgetMs() const
+{
+    if (targetPeriod > Clock::duration::zero()) {
+        return chrono::duration<float, milli>(targetPeriod).count();
+    }
+    if (mode == FRAME_VSYNC && vsyncIntervalMs > 0.0f) {
+        return vsyncIntervalMs;
+    }
+    return 1000.0f / 60.0f;
+}
+
+void FramePacer::waitForNextFrame()
+{
+    Clock::time_point workEnd = Clock::now();
+    lastWorkMs = chrono::duration<float, milli>(workEnd - workStart).count();
+
+    if (targetPeriod > Clock::duration::zero()) {
+        // Fase 1: dorme até a margem antes do prazo.
+        Clock::duration remaining = nextDeadline - workEnd;
+        if (remaining > sleepMargin) {
+            Clock::duration request = remaining - sleepMargin;
+            Clock::time_point sleepStart = Clock::now();
+            // sf::sleep e não this_thread::sleep_for: no Windows ele sobe a
+            // resolução do timer (timeBeginPeriod) antes de dormir; sem isso
+            // o sleep pode atrasar até ~15.6 ms.
+            sf::sleep(sf::microseconds(static_cast<sf::Int64>(
+                chrono::duration_cast<chrono::microseconds>(request).count())));
+            Clock::duration overshoot = (Clock::now() - sleepStart) - request;
+
+            // Ajusta a margem ao atraso real do sleep nesta máquina.
+            if (overshoot + chrono::microseconds(250) > sleepMargin) {
+                sleepMargin = min<Clock::duration>(overshoot + chrono::microseconds(500), MAX_SLEEP_MARGIN);
+            } else {
+                sleepMargin = max<Clock::duration>(sleepMargin - sleepMargin / 100, MIN_SLEEP_MARGIN);
+            }
+        }
+
+        // Fase 2: gira até o prazo exato.
+        while (Clock::now() < nextDeadline) {
+            this_thread::yield();
+        }
+
+        nextDeadline += targetPeriod;
+
+        // Se atrasou mais de um quadro inteiro, ressincroniza em vez de
+        // tentar recuperar com vários quadros seguidos.
+        Clock::time_point now = Clock::now();
+        if (now > nextDeadline) {
+            nextDeadline = now + targetPeriod;
+        }
+    }
+
+    Clock::time_point frameEnd = Clock::now();
+    lastFrameMs = chrono::duration<float, milli>(frameEnd - lastFrameStart).count();
+    lastFrameStart = frameEnd;
+    record(lastFrameMs);
+    if (mode == FRAME_VSYNC) {
+        recordVsyncSample(lastFrameMs);
+    }
+}
+
+void FramePacer::recordVsyncSample(float frameMs)
+{
+    // Mais rápido que 240 Hz não é um vblank: o driver está ignorando o
+    // VSync, e o orçamento fica nos 60 Hz.
+    if (frameMs < 1000.0f / 240.0f) return;
+
+    vsyncSamples[vsyncSampleCount++] = frameMs;
+    if (vsyncSampleCount < VSYNC_SAMPLES) return;
+
+    float* median = vsyncSamples + VSYNC_SAMPLES / 2;
+    nth_element(vsyncSamples, median, vsyncSamples + VSYNC_SAMPLES);
+    if (vsyncIntervalMs == 0.0f || *median < vsyncIntervalMs) {
+        vsyncIntervalMs = *median;
+    }
+    vsyncSampleCount = 0;
+}
+
+void FramePacer::resetHistogram()
+{
+    fill(histogram, histogram + HISTOGRAM_BUCKETS + 1, 0LL);
+    frameCount = 0;
+    totalMs = 0.0;
+    worstMs = 0.0;
+}
+
+void FramePacer::record(double frameMs)
+{
+    int bucket = static_cast<int>(frameMs / BUCKET_WIDTH_MS);
+    if (bucket < 0) bucket = 0;
+    if (bucket > HISTOGRAM_BUCKETS) bucket = HISTOGRAM_BUCKETS;
+    histogram[bucket]++;
+    frameCount++;
+    totalMs += frameMs;
+    worstMs = max(worstMs, frameMs);
+}
+
+double FramePacer::percentileMs(double percentile) const
+{
+    if (frameCount == 0) return 0.0;
+
+    long long target = static_cast<long long>(ceil(frameCount * percentile / 100.0));
+    long long accumulated = 0;
+    for (int i = 0; i <= HISTOGRAM_BUCKETS; ++i) {
+        accumulated += histogram[i];
+        if (accumulated >= target) {
+            return (i + 1) * BUCKET_WIDTH_MS;
+        }
+    }
+    return worstMs;
+}
+
+void FramePacer::printHistogram(ostream& out) const
+{
+    out << "=== Tempos de quadro (" << frameModeName(mode) << ", " << frameCount << " quadros) ===" << endl;
+    if (frameCount == 0) return;
+
+    out << fixed << setprecision(2);
+    out << "Media: " << totalMs / frameCount << " ms | p50: " << percentileMs(50.0)
+        << " ms | p99: " << percentileMs(99.0) << " ms | Pior: " << worstMs << " ms" << endl;
+
+    long long peak = *max_element(histogram, histogram + HISTOGRAM_BUCKETS + 1);
+    for (int i = 0; i <= HISTOGRAM_BUCKETS; ++i) {
+        if (histogram[i] == 0) continue;
+
+        int bar = static_cast<int>(40 * histogram[i] / peak);
+        if (i < HISTOGRAM_BUCKETS) {
+            out << setw(6) << i * BUCKET_WIDTH_MS << "-" << setw(6) << (i + 1) * BUCKET_WIDTH_MS << " ms ";
+        } else {
+            out << "      >" << setw(6) << i * BUCKET_WIDTH_MS << " ms ";
+        }
+        out << setw(8) << histogram[i] << " " << string(max(bar, 1), '#') << endl;
+    }
+    out.unsetf(ios::fixed);
+}
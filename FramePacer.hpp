@@ -0,0 +1,101 @@
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <ostream>
+#include <string>
+
+// =======================================================
+// MODOS DE RITMO DE QUADROS
+// =======================================================
+enum FrameMode {
+    FRAME_60HZ,
+    FRAME_120HZ,
+    FRAME_144HZ,
+    FRAME_VSYNC,
+    FRAME_UNCAPPED,
+    FRAME_MODE_COUNT
+};
+
+const char* frameModeName(FrameMode mode);
+
+// Converte "60", "120", "144", "vsync" ou "uncapped" no modo correspondente.
+bool parseFrameMode(const std::string& value, FrameMode& mode);
+
+// =======================================================
+// FRAME PACER
+// =======================================================
+// Substitui window.setFramerateLimit(), que só dorme e atrasa 1 ms ou mais
+// no Linux. A espera é híbrida: dorme (sf::sleep) até perto do prazo e
+// completa o resto girando no relógio steady_clock.
+class FramePacer {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // Histograma dos tempos de quadro em baldes de 0.5 ms (0 a 50 ms).
+    static const int HISTOGRAM_BUCKETS = 100;
+    static constexpr double BUCKET_WIDTH_MS = 0.5;
+
+    // Amostras de tempo de quadro por estimativa do intervalo do VSync.
+    static const int VSYNC_SAMPLES = 240;
+
+    FramePacer();
+
+    void setMode(FrameMode mode, sf::RenderWindow& window);
+    FrameMode getMode() const { return mode; }
+    FrameMode nextMode() const { return static_cast<FrameMode>((mode + 1) % FRAME_MODE_COUNT); }
+
+    // Chamar no início do loop: marca o começo do trabalho do quadro.
+    // Assim o tempo de trabalho não inclui o bloqueio do VSync no display().
+    void beginWork() { workStart = Clock::now(); }
+
+    // Chamar logo antes de window.display(): espera até o prazo do quadro
+    // e registra o tempo do quadro anterior no histograma.
+    void waitForNextFrame();
+
+    // Duração do último quadro completo e do trabalho (sem a espera).
+    float getLastFrameMs() const { return lastFrameMs; }
+    float getLastWorkMs() const { return lastWorkMs; }
+
+    // Orçamento de um quadro no modo atual. No VSync é o intervalo medido
+    // entre vblanks (ver getVsyncIntervalMs); sem medida ou sem limite, 60 Hz.
+    float getFrameBudgetMs() const;
+
+    // Intervalo entre vblanks medido no modo VSync (0 enquanto não há medida).
+    // SFML 2.5 não informa a frequência do monitor, então ela é medida: a
+    // mediana de cada janela de VSYNC_SAMPLES quadros (um quadro que pega o
+    // vblank dura um intervalo, um que perde dura dois ou mais), e vale a
+    // menor já vista, para uma fase de quadros perdidos não inflar a medida.
+    float getVsyncIntervalMs() const { return vsyncIntervalMs; }
+
+    void resetHistogram();
+    long long getFrameCount() const { return frameCount; }
+    double percentileMs(double percentile) const;
+    void printHistogram(std::ostream& out) const;
+
+private:
+    FrameMode mode;
+    Clock::duration targetPeriod;
+    Clock::time_point nextDeadline;
+    Clock::time_point lastFrameStart;
+    Clock::time_point workStart;
+    Clock::duration sleepMargin;
+
+    float lastFrameMs;
+    float lastWorkMs;
+
+    long long histogram[HISTOGRAM_BUCKETS + 1]; // último balde = acima de 50 ms
+    long long frameCount;
+    double totalMs;
+    double worstMs;
+
+    float vsyncSamples[VSYNC_SAMPLES];
+    int vsyncSampleCount;
+    float vsyncIntervalMs;
+
+    void record(double frameMs);
+    void recordVsyncSample(float frameMs);
+};
+
+#endif // FRAME_PACER_HPP
@@ -0,0 +1,780 @@
+#include "Game.hpp"
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <sstream>
+#include <cmath>
+#include <cassert>
+
+using namespace std;
+
+// =======================================================
+// ESTADO GLOBAL DO JOGO
+// =======================================================
+DifficultySettings easy = {60.0f, 1.5f, 2.5f, 150, "FACIL"};
+DifficultySettings normal = {45.0f, 1.0f, 2.0f, 100, "NORMAL"};
+DifficultySettings hard = {30.0f, 0.5f, 1.5f, 50, "DIFICIL"};
+
+DifficultySettings currentDifficulty;
+int currentScore = 0;
+sf::Clock gameClock;
+sf::Time gameTimeLimit;
+
+vector<Hole> holes;
+
+BoardLayoutId currentLayout = LAYOUT_CLASSIC;
+
+ParticleSystem hitEffects(PARTICLE_CAPACITY);
+
+// =======================================================
+// FUNÇÕES AUXILIARES
+// =======================================================
+
+bool isCircleClicked(const sf::Vector2f& mousePos, const sf::Vector2f& center, float radius)
+{
+    float dx = mousePos.x - center.x;
+    float dy = mousePos.y - center.y;
+    float distanceSquared = dx * dx + dy * dy;
+    return distanceSquared <= (radius * radius);
+}
+
+void initializeHoles() {
+    holes.clear();
+    withBoard(currentLayout, [](auto board) {
+        typedef decltype(board) BoardType;
+        holes.reserve(BoardType::NUM_HOLES);
+        BoardType::forEachHole([](int, const sf::Vector2f& position) {
+            Hole h;
+            h.position = position;
+            h.hasCapybara = false;
+            h.capybaraDuration = 0.0f;
+            holes.push_back(h);
+        });
+    });
+}
+
+// withBoard para o tabuleiro atual, indexando holes[i] com os índices do
+// layout. holes é montado pelo último initializeHoles(): se o layout mudou
+// sem reiniciar o jogo, os tamanhos não batem e nada é feito.
+template <typename Fn>
+static void withCurrentBoard(Fn&& fn)
+{
+    withBoard(currentLayout, [&](auto board) {
+        bool matches = holes.size() == static_cast<size_t>(decltype(board)::NUM_HOLES);
+        assert(matches && "holes não corresponde ao layout atual; chame initializeHoles()");
+        if (matches) fn(board);
+    });
+}
+
+void startGame(const DifficultySettings& settings) {
+    currentDifficulty = settings;
+    currentScore = 0;
+    gameTimeLimit = sf::seconds(settings.gameDuration);
+    gameClock.restart();
+    initializeHoles();
+    hitEffects.clear();
+    cout << "Jogo iniciado! Dificuldade: " << settings.name
+         << " | Tabuleiro: " << boardLayoutName(currentLayout) << endl;
+}
+
+void spawnCapybara(Hole& hole) {
+    hole.hasCapybara = true;
+    hole.capybaraTimer.restart();
+    float range = currentDifficulty.maxCapybaraDuration - currentDifficulty.minCapybaraDuration;
+    hole.capybaraDuration = currentDifficulty.minCapybaraDuration + (float)rand() / (float)RAND_MAX * range;
+}
+
+void hitCapybara(Hole& hole) {
+    hole.hasCapybara = false;
+    currentScore++;
+    hitEffects.emitBurst(hole.position, HIT_BURST_PARTICLES);
+    hitEffects.emitScorePopup(sf::Vector2f(hole.position.x, hole.position.y - boardMoleRadius(currentLayout)), 1);
+    cout << "ACERTOU! Pontos: " << currentScore << endl;
+}
+
+int resolveClick(const sf::Vector2f& mousePos) {
+    int hits = 0;
+    withCurrentBoard([&](auto board) {
+        decltype(board)::forEachHit(mousePos, [&](int i) {
+            if (holes[i].hasCapybara) {
+                hitCapybara(holes[i]);
+                hits++;
+            }
+        });
+    });
+    return hits;
+}
+
+bool isOverCapybara(const sf::Vector2f& mousePos) {
+    bool found = false;
+    withCurrentBoard([&](auto board) {
+        decltype(board)::forEachHit(mousePos, [&](int i) {
+            found = found || holes[i].hasCapybara;
+        });
+    });
+    return found;
+}
+
+void updateCapybaras() {
+    withCurrentBoard([](auto board) {
+        decltype(board)::forEachHole([](int i, const sf::Vector2f&) {
+            if (!holes[i].hasCapybara) {
+                if (rand() % currentDifficulty.spawnRate == 0) {
+                    spawnCapybara(holes[i]);
+                }
+            } else {
+                if (holes[i].capybaraTimer.getElapsedTime().asSeconds() > holes[i].capybaraDuration) {
+                    holes[i].hasCapybara = false;
+                }
+            }
+        });
+    });
+}
+
+void updateHud(const sf::Time& remainingTime, sf::Text& scoreText, sf::Text& timeText, sf::RectangleShape& timeBar) {
+    float timeRatio = remainingTime.asSeconds() / currentDifficulty.gameDuration;
+    timeBar.setSize(sf::Vector2f((WINDOW_WIDTH - 100.0f) * timeRatio, 30.0f));
+    timeBar.setFillColor(timeRatio > 0.5f ? sf::Color::Green :
+                        (timeRatio > 0.2f ? sf::Color::Yellow : sf::Color::Red));
+
+    ostringstream timeStream;
+    timeStream << "Tempo: " << static_cast<int>(ceil(remainingTime.asSeconds()));
+    timeText.setString(timeStream.str());
+
+    ostringstream scoreStream;
+    scoreStream << "Pontos: " << currentScore;
+    scoreText.setString(scoreStream.str());
+}
+
+// =======================================================
+// RECURSOS DAS TELAS
+// =======================================================
+
+static string assetPath(const string& assetsDir, const string& name)
+{
+    return assetsDir.empty() ? name : assetsDir + "/" + name;
+}
+
+// Texturas de cada tela e da provável próxima. escolha.png serve a
+// Dificuldade e o Tutorial, então fica uma única vez no cache.
+struct ScreenArt {
+    const char* textures[2];
+    const char* next[2];
+};
+
+static const ScreenArt& screenArt(GameState state)
+{
+    static const ScreenArt MENU_ART       = {{"inicial.png", NULL},               {"escolha.png", NULL}};
+    static const ScreenArt DIFFICULTY_ART = {{"escolha.png", NULL},               {"fundoGAME.png", "toupeira.png"}};
+    static const ScreenArt PLAYING_ART    = {{"fundoGAME.png", "toupeira.png"},   {NULL, NULL}};
+    static const ScreenArt GAME_OVER_ART  = {{"fundoGAME.png", NULL},             {"inicial.png", NULL}};
+    static const ScreenArt OPTIONS_ART    = {{"options_menu.png", NULL},          {"inicial.png", NULL}};
+    static const ScreenArt TUTORIAL_ART   = {{"escolha.png", NULL},               {"inicial.png", NULL}};
+
+    switch (state) {
+        case DIFFICULTY_CHOICE: return DIFFICULTY_ART;
+        case PLAYING:           return PLAYING_ART;
+        case GAME_OVER:         return GAME_OVER_ART;
+        case OPTIONS_MENU:      return OPTIONS_ART;
+        case TUTORIAL:          return TUTORIAL_ART;
+        case MENU:
+        default:                return MENU_ART;
+    }
+}
+
+// Sprites que usam cada uma das texturas da tela, na mesma ordem.
+static void screenSprites(ScreenResources& screens, GameState state, sf::Sprite* sprites[2])
+{
+    sprites[1] = NULL;
+    switch (state) {
+        case DIFFICULTY_CHOICE: sprites[0] = &screens.choiceBackgroundSprite; break;
+        case PLAYING:           sprites[0] = &screens.gameBackgroundSprite;
+                                sprites[1] = &screens.ToupeiraSprite;        break;
+        case GAME_OVER:         sprites[0] = &screens.gameBackgroundSprite;   break;
+        case OPTIONS_MENU:      sprites[0] = &screens.optionsMenuSprite;      break;
+        case TUTORIAL:          sprites[0] = &screens.tutorialMenuSprite;     break;
+        case MENU:
+        default:                sprites[0] = &screens.menuInicialSprite;      break;
+    }
+}
+
+bool useScreen(ScreenResources& screens, GameState state)
+{
+    if (screens.hasBoundState && screens.boundState == state) return true;
+
+    // Prende as novas antes de soltar as antigas: uma textura comum às
+    // duas telas (fundoGAME.png entre o jogo e o Game Over) não sai do cache.
+    const ScreenArt& art = screenArt(state);
+    sf::Sprite* sprites[2];
+    screenSprites(screens, state, sprites);
+
+    bool ok = true;
+    for (int i = 0; i < 2 && art.textures[i] != NULL; ++i) {
+        const sf::Texture* texture = screens.textures.acquire(art.textures[i]);
+        if (texture == NULL) {
+            ok = false;
+            continue;
+        }
+        sprites[i]->setTexture(*texture, true);
+    }
+
+    if (state == PLAYING && screens.ToupeiraSprite.getTexture() != NULL) {
+        sf::Vector2u moleSize = screens.ToupeiraSprite.getTexture()->getSize();
+        screens.ToupeiraSprite.setOrigin(moleSize.x / 2.0f, moleSize.y / 2.0f);
+    }
+
+    if (screens.hasBoundState) {
+        const ScreenArt& previous = screenArt(screens.boundState);
+        for (int i = 0; i < 2 && previous.textures[i] != NULL; ++i) {
+            screens.textures.release(previous.textures[i]);
+        }
+    }
+
+    // Prefetches da tela anterior não valem mais
+    screens.textures.clearPrefetch();
+    for (int i = 0; i < 2 && art.next[i] != NULL; ++i) {
+        screens.textures.prefetch(art.next[i]);
+    }
+
+    screens.boundState = state;
+    screens.hasBoundState = true;
+    return ok;
+}
+
+bool loadScreenResources(ScreenResources& screens, const string& assetsDir)
+{
+    // Só confirma que as artes existem; cada uma é decodificada quando a
+    // tela dela for usada.
+    static const char* SCREEN_ART_FILES[] = {
+        "inicial.png", "escolha.png", "fundoGAME.png", "toupeira.png", "options_menu.png"
+    };
+    for (const char* name : SCREEN_ART_FILES) {
+        if (!ifstream(assetPath(assetsDir, name).c_str(), ios::binary)) {
+            cout << "Erro ao carregar a textura " << name << endl; return false;
+        }
+    }
+    screens.textures.setAssetsDir(assetsDir);
+
+    if (!screens.font.loadFromFile(assetPath(assetsDir, "arial.ttf"))) {
+        if (!screens.font.loadFromFile("bin/Debug/arial.ttf")) {
+            if (!screens.font.loadFromFile("C:/Windows/Fonts/arial.ttf")) {
+                cerr << "ERRO FATAL: Nao foi possivel carregar a fonte 'arial.ttf'" << endl;
+                return false;
+            }
+        }
+    }
+    cout << "Fonte 'arial.ttf' carregada com sucesso!" << endl;
+
+    screens.muteXText.setFont(screens.font);
+    screens.muteXText.setString("X");
+    screens.muteXText.setCharacterSize(60);
+    screens.muteXText.setFillColor(sf::Color::Red);
+    screens.muteXText.setStyle(sf::Text::Bold);
+    sf::FloatRect textBounds = screens.muteXText.getLocalBounds();
+    screens.muteXText.setOrigin(textBounds.left + textBounds.width / 2.0f,
+                                textBounds.top + textBounds.height / 2.0f);
+
+    screens.backgroundSoundIconPos = sf::Vector2f(650.0f, 625.0f);
+    screens.clickSoundIconPos = sf::Vector2f(650.0f, 735.0f);
+
+    // =======================================================
+    // TEXTOS DO JOGO
+    // =======================================================
+    screens.scoreText.setString("Pontos: 0");
+    screens.scoreText.setFont(screens.font);
+    screens.scoreText.setCharacterSize(40);
+    screens.scoreText.setFillColor(sf::Color::Black);
+    screens.scoreText.setPosition(50.0f, 50.0f);
+
+    screens.timeText.setString("Tempo: 60");
+    screens.timeText.setFont(screens.font);
+    screens.timeText.setCharacterSize(40);
+    screens.timeText.setFillColor(sf::Color::Black);
+    screens.timeText.setPosition(WINDOW_WIDTH - 250.0f, 50.0f);
+
+    screens.timeBar.setSize(sf::Vector2f(WINDOW_WIDTH - 100.0f, 30.0f));
+    screens.timeBar.setFillColor(sf::Color::Green);
+    screens.timeBar.setPosition(50.0f, 10.0f);
+
+    // =======================================================
+    // TEXTOS DA TELA DE GAME OVER (MELHORADA)
+    // =======================================================
+    screens.gameOverText.setString("FIM DE JOGO!");
+    screens.gameOverText.setFont(screens.font);
+    screens.gameOverText.setCharacterSize(70);
+    screens.gameOverText.setFillColor(sf::Color(220, 20, 60)); // Vermelho intenso
+    screens.gameOverText.setStyle(sf::Text::Bold);
+
+    screens.finalScoreText.setFont(screens.font);
+    screens.finalScoreText.setCharacterSize(50);
+    screens.finalScoreText.setFillColor(sf::Color::White);
+    screens.finalScoreText.setStyle(sf::Text::Bold);
+
+    screens.difficultyText.setFont(screens.font);
+    screens.difficultyText.setCharacterSize(35);
+    screens.difficultyText.setFillColor(sf::Color(255, 215, 0)); // Dourado
+
+    screens.clickToContinue.setString("Clique em qualquer lugar para voltar ao Menu");
+    screens.clickToContinue.setFont(screens.font);
+    screens.clickToContinue.setCharacterSize(28);
+    screens.clickToContinue.setFillColor(sf::Color::White);
+
+    // Painel de pontuação
+    screens.scorePanel.setSize(sf::Vector2f(600.0f, 400.0f));
+    screens.scorePanel.setFillColor(sf::Color(0, 0, 0, 180)); // Preto semi-transparente
+    screens.scorePanel.setOutlineThickness(5.0f);
+    screens.scorePanel.setOutlineColor(sf::Color::White);
+
+    // Botão do layout do tabuleiro (desenhado por cima da arte de Dificuldade)
+    screens.botaoLayout = sf::FloatRect(366, 860, 289, 60);
+    screens.layoutButton.setSize(sf::Vector2f(screens.botaoLayout.width, screens.botaoLayout.height));
+    screens.layoutButton.setPosition(screens.botaoLayout.left, screens.botaoLayout.top);
+    screens.layoutButton.setFillColor(sf::Color(0, 0, 0, 160));
+    screens.layoutButton.setOutlineThickness(3.0f);
+    screens.layoutButton.setOutlineColor(sf::Color::White);
+
+    screens.layoutText.setFont(screens.font);
+    screens.layoutText.setCharacterSize(28);
+    screens.layoutText.setFillColor(sf::Color::White);
+    screens.layoutText.setStyle(sf::Text::Bold);
+
+    // Botão de ritmo de quadros (desenhado por cima da arte de Options)
+    screens.botaoFrameMode = sf::FloatRect(360, 790, 300, 70);
+    screens.frameModeButton.setSize(sf::Vector2f(screens.botaoFrameMode.width, screens.botaoFrameMode.height));
+    screens.frameModeButton.setPosition(screens.botaoFrameMode.left, screens.botaoFrameMode.top);
+    screens.frameModeButton.setFillColor(sf::Color(0, 0, 0, 160));
+    screens.frameModeButton.setOutlineThickness(3.0f);
+    screens.frameModeButton.setOutlineColor(sf::Color::White);
+
+    screens.frameModeText.setFont(screens.font);
+    screens.frameModeText.setCharacterSize(32);
+    screens.frameModeText.setFillColor(sf::Color::White);
+    screens.frameModeText.setStyle(sf::Text::Bold);
+
+    // Arte da tela inicial
+    return useScreen(screens, MENU);
+}
+
+void updateGameOverTexts(ScreenResources& screens)
+{
+    screens.finalScoreText.setString("PONTUACAO: " + to_string(currentScore));
+    screens.difficultyText.setString("Dificuldade: " + currentDifficulty.name);
+}
+
+void DrawScreen(sf::RenderTarget& target, GameState state, ScreenResources& screens,
+                bool isBackgroundSoundMuted, bool isClickSoundMuted, FrameMode frameMode)
+{
+    useScreen(screens, state);
+
+    if (state == MENU) {
+        DrawMenu(target, screens.menuInicialSprite);
+    }
+    else if (state == DIFFICULTY_CHOICE) {
+        DrawDifficulty(target, screens.choiceBackgroundSprite, screens.layoutButton, screens.layoutText);
+    }
+    else if (state == PLAYING) {
+        DrawGame(target, screens.gameBackgroundSprite, screens.ToupeiraSprite,
+                 screens.scoreText, screens.timeText, screens.timeBar);
+    }
+    else if (state == GAME_OVER) {
+        DrawGameOver(target, screens.gameBackgroundSprite, screens.gameOverText, screens.finalScoreText,
+                     screens.difficultyText, screens.clickToContinue, screens.scorePanel);
+    }
+    else if (state == OPTIONS_MENU) {
+        DrawOptions(target, screens.optionsMenuSprite, screens.muteXText,
+                    screens.backgroundSoundIconPos, screens.clickSoundIconPos,
+                    isBackgroundSoundMuted, isClickSoundMuted,
+                    screens.frameModeButton, screens.frameModeText, frameMode);
+    }
+    else if (state == TUTORIAL) {
+        DrawTutorial(target, screens.tutorialMenuSprite, screens.font);
+    }
+}
+
+// =======================================================
+// IMPLEMENTAÇÕES DAS FUNÇÕES DE TELA
+// =======================================================
+
+void DrawMenu(sf::RenderTarget& target, const sf::Sprite& menuSprite)
+{
+    target.draw(menuSprite);
+}
+
+void DrawDifficulty(sf::RenderTarget& target, const sf::Sprite& choiceSprite,
+                    sf::RectangleShape& layoutButton, sf::Text& layoutText)
+{
+    target.draw(choiceSprite);
+
+    // Botão do layout do tabuleiro com o texto centralizado
+    target.draw(layoutButton);
+    layoutText.setString(string("Tabuleiro: ") + boardLayoutName(currentLayout));
+    sf::FloatRect bounds = layoutText.getLocalBounds();
+    layoutText.setOrigin(bounds.left + bounds.width / 2.0f, bounds.top + bounds.height / 2.0f);
+    layoutText.setPosition(layoutButton.getPosition().x + layoutButton.getSize().x / 2.0f,
+                           layoutButton.getPosition().y + layoutButton.getSize().y / 2.0f);
+    target.draw(layoutText);
+}
+
+// Gramado liso (degradê claro -> escuro como o da arte) que cobre os 9
+// buracos pintados em fundoGAME.png, mantendo o céu. Usado pelos layouts
+// que desenham os próprios buracos.
+static const sf::VertexArray& holeFreeGrass()
+{
+    static sf::VertexArray grass(sf::Quads);
+    if (grass.getVertexCount() > 0) return grass;
+
+    const int SEGMENTS = 64;
+    const float MIDDLE_Y = 420.0f;
+    const sf::Color top(186, 241, 100);
+    const sf::Color middle(150, 210, 68);
+    const sf::Color bottom(109, 169, 54);
+
+    for (int s = 0; s < SEGMENTS; ++s) {
+        float x0 = WINDOW_WIDTH * s / SEGMENTS;
+        float x1 = WINDOW_WIDTH * (s + 1) / SEGMENTS;
+
+        grass.append(sf::Vertex(sf::Vector2f(x0, grassHorizonY(x0)), top));
+        grass.append(sf::Vertex(sf::Vector2f(x1, grassHorizonY(x1)), top));
+        grass.append(sf::Vertex(sf::Vector2f(x1, MIDDLE_Y), middle));
+        grass.append(sf::Vertex(sf::Vector2f(x0, MIDDLE_Y), middle));
+
+        grass.append(sf::Vertex(sf::Vector2f(x0, MIDDLE_Y), middle));
+        grass.append(sf::Vertex(sf::Vector2f(x1, MIDDLE_Y), middle));
+        grass.append(sf::Vertex(sf::Vector2f(x1, WINDOW_HEIGHT), bottom));
+        grass.append(sf::Vertex(sf::Vector2f(x0, WINDOW_HEIGHT), bottom));
+    }
+    return grass;
+}
+
+void DrawGame(sf::RenderTarget& target, const sf::Sprite& gameSprite, sf::Sprite& ToupeiraSprite,
+              sf::Text& scoreText, sf::Text& timeText, sf::RectangleShape& timeBar)
+{
+    target.draw(gameSprite);
+
+    withCurrentBoard([&](auto board) {
+        typedef decltype(board) BoardType;
+
+        // Layouts fora da arte de fundo cobrem os buracos da arte e
+        // desenham os próprios
+        if (BoardType::LayoutType::DRAW_HOLES) {
+            target.draw(holeFreeGrass());
+
+            sf::CircleShape holeShape(BoardType::MOLE_RADIUS * HOLE_RADIUS_RATIO);
+            holeShape.setOrigin(holeShape.getRadius(), holeShape.getRadius());
+            holeShape.setScale(1.0f, HOLE_SQUASH);
+            holeShape.setFillColor(sf::Color(60, 40, 20));
+            BoardType::forEachHole([&](int, const sf::Vector2f& position) {
+                holeShape.setPosition(position.x, position.y + BoardType::MOLE_RADIUS * HOLE_OFFSET_RATIO);
+                target.draw(holeShape);
+            });
+        }
+
+        // Desenha todas as capivaras visíveis, na escala do layout
+        float scale = BoardType::MOLE_RADIUS / ClassicLayout::MOLE_RADIUS;
+        ToupeiraSprite.setScale(scale, scale);
+        BoardType::forEachHole([&](int i, const sf::Vector2f& position) {
+            if (holes[i].hasCapybara) {
+                ToupeiraSprite.setPosition(position);
+                target.draw(ToupeiraSprite);
+            }
+        });
+    });
+
+    // Partículas de acerto: um único draw call
+    target.draw(hitEffects);
+
+    target.draw(scoreText);
+    target.draw(timeText);
+    target.draw(timeBar);
+}
+
+void DrawGameOver(sf::RenderTarget& target, const sf::Sprite& gameBackgroundSprite,
+                  sf::Text& gameOverText, sf::Text& finalScoreText, sf::Text& difficultyText,
+                  sf::Text& clickToContinue, sf::RectangleShape& scorePanel)
+{
+    target.draw(gameBackgroundSprite);
+
+    // Centraliza o painel
+    scorePanel.setPosition(WINDOW_WIDTH / 2.0f - scorePanel.getSize().x / 2.0f,
+                          WINDOW_HEIGHT / 2.0f - scorePanel.getSize().y / 2.0f);
+    target.draw(scorePanel);
+
+    // Centraliza os textos
+    sf::FloatRect bounds = gameOverText.getGlobalBounds();
+    gameOverText.setPosition(WINDOW_WIDTH / 2.0f - bounds.width / 2.0f,
+                            WINDOW_HEIGHT / 2.0f - 150.0f);
+    target.draw(gameOverText);
+
+    bounds = finalScoreText.getGlobalBounds();
+    finalScoreText.setPosition(WINDOW_WIDTH / 2.0f - bounds.width / 2.0f,
+                              WINDOW_HEIGHT / 2.0f - 50.0f);
+    target.draw(finalScoreText);
+
+    bounds = difficultyText.getGlobalBounds();
+    difficultyText.setPosition(WINDOW_WIDTH / 2.0f - bounds.width / 2.0f,
+                              WINDOW_HEIGHT / 2.0f + 30.0f);
+    target.draw(difficultyText);
+
+    bounds = clickToContinue.getGlobalBounds();
+    clickToContinue.setPosition(WINDOW_WIDTH / 2.0f - bounds.width / 2.0f,
+                               WINDOW_HEIGHT / 2.0f + 120.0f);
+    target.draw(clickToContinue);
+}
+
+void DrawOptions(sf::RenderTarget& target, const sf::Sprite& optionsMenuSprite,
+                 sf::Text& muteXText, const sf::Vector2f& bgIconPos, const sf::Vector2f& clickIconPos,
+                 bool isBackgroundSoundMuted, bool isClickSoundMuted,
+                 sf::RectangleShape& frameModeButton, sf::Text& frameModeText, FrameMode frameMode)
+{
+    target.draw(optionsMenuSprite);
+
+    if (isBackgroundSoundMuted) {
+        muteXText.setPosition(bgIconPos);
+        target.draw(muteXText);
+    }
+
+    if (isClickSoundMuted) {
+        muteXText.setPosition(clickIconPos);
+        target.draw(muteXText);
+    }
+
+    // Botão de ritmo de quadros com o texto centralizado
+    target.draw(frameModeButton);
+    frameModeText.setString(string("FPS: ") + frameModeName(frameMode));
+    sf::FloatRect bounds = frameModeText.getLocalBounds();
+    frameModeText.setOrigin(bounds.left + bounds.width / 2.0f, bounds.top + bounds.height / 2.0f);
+    frameModeText.setPosition(frameModeButton.getPosition().x + frameModeButton.getSize().x / 2.0f,
+                              frameModeButton.getPosition().y + frameModeButton.getSize().y / 2.0f);
+    target.draw(frameModeText);
+}
+
+void DrawTutorial(sf::RenderTarget& target, const sf::Sprite& tutorialMenuSprite, const sf::Font& font)
+{
+    target.draw(tutorialMenuSprite);
+
+    // Título
+    sf::Text tutorialTitle("COMO JOGAR", font, 70);
+    tutorialTitle.setFillColor(sf::Color::Black);
+    tutorialTitle.setStyle(sf::Text::Bold);
+    sf::FloatRect bounds = tutorialTitle.getGlobalBounds();
+    tutorialTitle.setPosition(WINDOW_WIDTH / 2.0f - bounds.width / 2.0f, 150.0f);
+    target.draw(tutorialTitle);
+
+    // Painel de fundo para o texto
+    sf::RectangleShape textPanel(sf::Vector2f(800.0f, 450.0f));
+    textPanel.setFillColor(sf::Color(255, 255, 255, 220));
+    textPanel.setOutlineThickness(4.0f);
+    textPanel.setOutlineColor(sf::Color::Black);
+    textPanel.setPosition(WINDOW_WIDTH / 2.0f - 400.0f, 280.0f);
+    target.draw(textPanel);
+
+    // Instruções detalhadas
+    sf::Text instruction1("1. Clique nas CAPIVARAS que aparecem nos buracos", font, 32);
+    instruction1.setFillColor(sf::Color::Black);
+    instruction1.setPosition(150.0f, 320.0f);
+    target.draw(instruction1);
+
+    sf::Text instruction2("2. Cada capivara acertada vale 1 ponto", font, 32);
+    instruction2.setFillColor(sf::Color::Black);
+    instruction2.setPosition(150.0f, 380.0f);
+    target.draw(instruction2);
+
+    sf::Text instruction3("3. As capivaras fogem rapidamente!", font, 32);
+    instruction3.setFillColor(sf::Color::Black);
+    instruction3.setPosition(150.0f, 440.0f);
+    target.draw(instruction3);
+
+    sf::Text instruction4("4. Fique atento ao tempo restante", font, 32);
+    instruction4.setFillColor(sf::Color::Black);
+    instruction4.setPosition(150.0f, 500.0f);
+    target.draw(instruction4);
+
+    sf::Text instruction5("5. Escolha a dificuldade que preferir:", font, 32);
+    instruction5.setFillColor(sf::Color::Black);
+    instruction5.setPosition(150.0f, 560.0f);
+    target.draw(instruction5);
+
+    sf::Text instruction6("   - FACIL: 60s | Capivaras lentas", font, 28);
+    instruction6.setFillColor(sf::Color(0, 128, 0));
+    instruction6.setPosition(150.0f, 605.0f);
+    target.draw(instruction6);
+
+    sf::Text instruction7("   - NORMAL: 45s | Velocidade media", font, 28);
+    instruction7.setFillColor(sf::Color(255, 140, 0));
+    instruction7.setPosition(150.0f, 645.0f);
+    target.draw(instruction7);
+
+    sf::Text instruction8("   - DIFICIL: 30s | Capivaras rapidas!", font, 28);
+    instruction8.setFillColor(sf::Color::Red);
+    instruction8.setPosition(150.0f, 685.0f);
+    target.draw(instruction8);
+
+    // Dica
+    sf::Text tip("DICA: Pressione ESC para voltar ao menu a qualquer momento", font, 24);
+    tip.setFillColor(sf::Color(50, 50, 50));
+    tip.setStyle(sf::Text::Italic);
+    bounds = tip.getGlobalBounds();
+    tip.setPosition(WINDOW_WIDTH / 2.0f - bounds.width / 2.0f, 780.0f);
+    target.draw(tip);
+}
+
+// =======================================================
+// IMPLEMENTAÇÕES DAS FUNÇÕES DE EVENTOS
+// =======================================================
+
+void HandleMenuEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                      const sf::FloatRect& botaoPlay, const sf::FloatRect& botaoOptions,
+                      const sf::FloatRect& botaoTutorial, const sf::FloatRect& botaoExit, sf::Sound& clickSound, bool isClickSoundMuted)
+{
+    sf::Vector2f mousePosition = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+
+    if (botaoPlay.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        cout << "Botao Play Clicado - Transicao para Dificuldade" << endl;
+        currentState = DIFFICULTY_CHOICE;
+    }
+    else if (botaoOptions.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        cout << "Botao Options Clicado - Transicao para Opcoes" << endl;
+        currentState = OPTIONS_MENU;
+    }
+    else if (botaoTutorial.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        cout << "Botao Tutorial Clicado - Transicao para Tutorial" << endl;
+        currentState = TUTORIAL;
+    }
+    else if (botaoExit.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        cout << "Botao Exit Clicado - Fechando jogo" << endl;
+        window.close();
+    }
+}
+
+void HandleGamingEvents(sf::Event& event, sf::RenderTarget& target, GameState& currentState, sf::Sound& clickSound, bool isClickSoundMuted)
+{
+    if (event.type == sf::Event::MouseButtonPressed) {
+        if (event.mouseButton.button == sf::Mouse::Left) {
+            sf::Vector2f mousePos = target.mapPixelToCoords(sf::Vector2i(event.mouseButton.x, event.mouseButton.y));
+            if (resolveClick(mousePos) > 0 && !isClickSoundMuted) {
+                clickSound.play();
+            }
+        }
+    }
+}
+
+void HandleDifficultyEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                            const sf::FloatRect& botaoEasy, const sf::FloatRect& botaoNormal,
+                            const sf::FloatRect& botaoHard, const sf::FloatRect& botaoLayout,
+                            const sf::Vector2f& centerBack, float radiusBack, sf::Sound& clickSound, bool isClickSoundMuted)
+{
+    sf::Vector2f mousePosition = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+
+    if (isCircleClicked(mousePosition, centerBack, radiusBack))
+    {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        currentState = MENU;
+        cout << "Botao Voltar Clicado (Dificuldade)!" << endl;
+    }
+    else if (botaoEasy.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        startGame(easy);
+        currentState = PLAYING;
+    }
+    else if (botaoNormal.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        startGame(normal);
+        currentState = PLAYING;
+    }
+    else if (botaoHard.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        startGame(hard);
+        currentState = PLAYING;
+    }
+    else if (botaoLayout.contains(mousePosition)) {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        currentLayout = static_cast<BoardLayoutId>((currentLayout + 1) % LAYOUT_COUNT);
+        cout << "Botao Tabuleiro Clicado! Layout: " << boardLayoutName(currentLayout) << endl;
+    }
+}
+
+void HandleOptionsEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                         const sf::Vector2f& centerBackOptions, float radiusBackOptions,
+                         const sf::FloatRect& botaoBackgroundSound, const sf::FloatRect& botaoClickSound,
+                         const sf::FloatRect& botaoFrameMode, FramePacer& framePacer,
+                         bool& isBackgroundSoundMuted, bool& isClickSoundMuted, sf::Music& menuMusic, sf::Sound& clickSound)
+{
+    sf::Vector2f mousePosition = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+
+    if (isCircleClicked(mousePosition, centerBackOptions, radiusBackOptions))
+    {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        currentState = MENU;
+        cout << "Botao Voltar Clicado (Opcoes)!" << endl;
+    }
+    else if (botaoBackgroundSound.contains(mousePosition))
+    {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        isBackgroundSoundMuted = !isBackgroundSoundMuted;
+        cout << "Bot ao Background Sound Clicado! Mudo: " << isBackgroundSoundMuted << endl;
+
+        if (isBackgroundSoundMuted) {
+            menuMusic.setVolume(0);
+        } else {
+            menuMusic.setVolume(100);
+        }
+    }
+    else if (botaoClickSound.contains(mousePosition))
+    {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        isClickSoundMuted = !isClickSoundMuted;
+        cout << "Botao Click Sound Clicado! Mudo: " << isClickSoundMuted << endl;
+    }
+    else if (botaoFrameMode.contains(mousePosition))
+    {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        framePacer.printHistogram(cout);
+        framePacer.setMode(framePacer.nextMode(), window);
+        cout << "Botao FPS Clicado! Modo: " << frameModeName(framePacer.getMode()) << endl;
+    }
+}
+
+void HandleTutorialEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                          const sf::Vector2f& centerBackTutorial, float radiusBackTutorial, sf::Sound& clickSound, bool isClickSoundMuted)
+{
+    sf::Vector2f mousePosition = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+
+    if (isCircleClicked(mousePosition, centerBackTutorial, radiusBackTutorial))
+    {
+        if(!isClickSoundMuted) {
+            clickSound.play();
+        }
+        currentState = MENU;
+        cout << "Botao Voltar Clicado (Tutorial)!" << endl;
+    }
+}
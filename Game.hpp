@@ -0,0 +1,218 @@
+#ifndef GAME_HPP
+#define GAME_HPP
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <SFML/Window.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "BoardLayouts.hpp"
+#include "FramePacer.hpp"
+#include "ParticleSystem.hpp"
+#include "TextureCache.hpp"
+
+// =======================================================
+// NÚCLEO DO JOGO
+// =======================================================
+// Estado, lógica e telas do jogo, separados de main() para poderem ser
+// usados também pelo executável de benchmark.
+
+// =======================================================
+// ENUMERAÇÃO DE ESTADOS DO JOGO
+// =======================================================
+enum GameState {
+    MENU,
+    DIFFICULTY_CHOICE,
+    PLAYING,
+    GAME_OVER,
+    OPTIONS_MENU,
+    TUTORIAL
+};
+
+// =======================================================
+// ESTRUTURAS E CONSTANTES DO JOGO
+// =======================================================
+// Tamanho lógico da tela: todas as coordenadas do jogo usam este espaço,
+// independente da resolução interna e do tamanho real da janela.
+const float WINDOW_WIDTH = 1024.0f;
+const float WINDOW_HEIGHT = 1024.0f;
+
+// Definições de Dificuldade
+struct DifficultySettings {
+    float gameDuration;
+    float minCapybaraDuration;
+    float maxCapybaraDuration;
+    int spawnRate;
+    std::string name;
+};
+
+extern DifficultySettings easy;
+extern DifficultySettings normal;
+extern DifficultySettings hard;
+
+extern DifficultySettings currentDifficulty;
+extern int currentScore;
+extern sf::Clock gameClock;
+extern sf::Time gameTimeLimit;
+
+struct Hole {
+    sf::Vector2f position;
+    bool hasCapybara;
+    sf::Clock capybaraTimer;
+    float capybaraDuration;
+};
+
+extern std::vector<Hole> holes;
+
+// Layout do tabuleiro escolhido na tela de dificuldade (ver BoardLayouts.hpp)
+extern BoardLayoutId currentLayout;
+
+// Efeitos de acerto (explosão + "+1"), com pool fixo de partículas
+const std::size_t PARTICLE_CAPACITY = 32768;
+const int HIT_BURST_PARTICLES = 48;
+extern ParticleSystem hitEffects;
+
+// =======================================================
+// FUNÇÕES AUXILIARES
+// =======================================================
+
+bool isCircleClicked(const sf::Vector2f& mousePos, const sf::Vector2f& center, float radius);
+
+void initializeHoles();
+
+void startGame(const DifficultySettings& settings);
+
+void spawnCapybara(Hole& hole);
+
+void hitCapybara(Hole& hole);
+
+// Acerta as capivaras sob o ponto (coordenadas lógicas) e retorna quantas.
+// Não usa OpenGL nem áudio: quem chama converte o pixel e toca o som.
+int resolveClick(const sf::Vector2f& mousePos);
+
+// Verdadeiro se o ponto está sobre alguma capivara visível
+bool isOverCapybara(const sf::Vector2f& mousePos);
+
+// Sistema de spawn/expiração das capivaras (um passo por quadro)
+void updateCapybaras();
+
+// Atualiza placar, tempo e barra de tempo do HUD
+void updateHud(const sf::Time& remainingTime, sf::Text& scoreText, sf::Text& timeText, sf::RectangleShape& timeBar);
+
+// =======================================================
+// RECURSOS DAS TELAS
+// =======================================================
+// Texturas, sprites e textos usados pelas funções Draw*. Ficam juntos para
+// que o jogo e o renderizador de referência (golden) desenhem a mesma coisa.
+// Não pode ser copiado: os sprites e textos apontam para as texturas e a
+// fonte guardadas aqui.
+//
+// As texturas vêm do cache: só a arte da tela atual fica presa, e a da
+// provável próxima tela é pré-carregada (ver useScreen).
+struct ScreenResources : private sf::NonCopyable {
+    TextureCache textures;
+    GameState boundState;
+    bool hasBoundState;
+
+    ScreenResources() : boundState(MENU), hasBoundState(false) {}
+
+    sf::Sprite menuInicialSprite;
+    sf::Sprite choiceBackgroundSprite;
+    sf::Sprite gameBackgroundSprite;
+    sf::Sprite ToupeiraSprite;
+    sf::Sprite optionsMenuSprite;
+    sf::Sprite tutorialMenuSprite;
+
+    sf::Font font;
+
+    // Options
+    sf::Text muteXText;
+    sf::Vector2f backgroundSoundIconPos;
+    sf::Vector2f clickSoundIconPos;
+    sf::FloatRect botaoFrameMode;
+    sf::RectangleShape frameModeButton;
+    sf::Text frameModeText;
+
+    // Dificuldade
+    sf::FloatRect botaoLayout;
+    sf::RectangleShape layoutButton;
+    sf::Text layoutText;
+
+    // HUD do jogo
+    sf::Text scoreText;
+    sf::Text timeText;
+    sf::RectangleShape timeBar;
+
+    // Game Over
+    sf::Text gameOverText;
+    sf::Text finalScoreText;
+    sf::Text difficultyText;
+    sf::Text clickToContinue;
+    sf::RectangleShape scorePanel;
+};
+
+// Carrega a fonte e a arte do menu de assetsDir (vazio = pasta atual).
+// As outras texturas são carregadas quando a tela delas é usada.
+bool loadScreenResources(ScreenResources& screens, const std::string& assetsDir);
+
+// Prende no cache as texturas da tela, liga os sprites a elas, solta as da
+// tela anterior e agenda o prefetch da provável próxima tela. Não faz nada
+// se a tela não mudou.
+bool useScreen(ScreenResources& screens, GameState state);
+
+// Preenche pontuação e dificuldade da tela de Game Over.
+void updateGameOverTexts(ScreenResources& screens);
+
+// Desenha a tela do estado atual.
+void DrawScreen(sf::RenderTarget& target, GameState state, ScreenResources& screens,
+                bool isBackgroundSoundMuted, bool isClickSoundMuted, FrameMode frameMode);
+
+// =======================================================
+// DEFINIÇÃO DAS FUNÇÕES DE TELA (Protótipos)
+// =======================================================
+
+void DrawMenu(sf::RenderTarget& target, const sf::Sprite& menuSprite);
+
+void DrawDifficulty(sf::RenderTarget& target, const sf::Sprite& choiceSprite,
+                    sf::RectangleShape& layoutButton, sf::Text& layoutText);
+
+void DrawGame(sf::RenderTarget& target, const sf::Sprite& gameSprite, sf::Sprite& ToupeiraSprite,
+              sf::Text& scoreText, sf::Text& timeText, sf::RectangleShape& timeBar);
+
+void DrawGameOver(sf::RenderTarget& target, const sf::Sprite& gameBackgroundSprite,
+                  sf::Text& gameOverText, sf::Text& finalScoreText, sf::Text& difficultyText,
+                  sf::Text& clickToContinue, sf::RectangleShape& scorePanel);
+
+void DrawOptions(sf::RenderTarget& target, const sf::Sprite& optionsMenuSprite,
+                 sf::Text& muteXText, const sf::Vector2f& bgIconPos, const sf::Vector2f& clickIconPos,
+                 bool isBackgroundSoundMuted, bool isClickSoundMuted,
+                 sf::RectangleShape& frameModeButton, sf::Text& frameModeText, FrameMode frameMode);
+
+void DrawTutorial(sf::RenderTarget& target, const sf::Sprite& tutorialMenuSprite, const sf::Font& font);
+
+// =======================================================
+// DEFINIÇÃO DAS FUNÇÕES DE EVENTOS (Protótipos)
+// =======================================================
+
+void HandleMenuEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                      const sf::FloatRect& botaoPlay, const sf::FloatRect& botaoOptions,
+                      const sf::FloatRect& botaoTutorial, const sf::FloatRect& botaoExit, sf::Sound& clickSound, bool isClickSoundMuted);
+
+void HandleDifficultyEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                            const sf::FloatRect& botaoEasy, const sf::FloatRect& botaoNormal,
+                            const sf::FloatRect& botaoHard, const sf::FloatRect& botaoLayout,
+                            const sf::Vector2f& centerBack, float radiusBack, sf::Sound& clickSound, bool isClickSoundMuted);
+
+void HandleGamingEvents(sf::Event& event, sf::RenderTarget& target, GameState& currentState, sf::Sound& clickSound, bool isClickSoundMuted);
+
+void HandleOptionsEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                         const sf::Vector2f& centerBackOptions, float radiusBackOptions,
+                         const sf::FloatRect& botaoBackgroundSound, const sf::FloatRect& botaoClickSound,
+                         const sf::FloatRect& botaoFrameMode, FramePacer& framePacer,
+                         bool& isBackgroundSoundMuted, bool& isClickSoundMuted, sf::Music& menuMusic, sf::Sound& clickSound);
+
+void HandleTutorialEvents(sf::Event& event, sf::RenderWindow& window, GameState& currentState,
+                          const sf::Vector2f& centerBackTutorial, float radiusBackTutorial, sf::Sound& clickSound, bool isClickSoundMuted);
+
+#endif // GAME_HPP
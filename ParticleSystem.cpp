@@ -0,0 +1,192 @@
+#include "ParticleSystem.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+using namespace std;
+
+// Fonte de blocos 3x5 para o "+N" (dígitos 0-9 e o sinal de +).
+static const char* const BLOCK_GLYPHS[11][5] = {
+    {"###", "#.#", "#.#", "#.#", "###"}, // 0
+    {".#.", "##.", ".#.", ".#.", "###"}, // 1
+    {"###", "..#", "###", "#..", "###"}, // 2
+    {"###", "..#", "###", "..#", "###"}, // 3
+    {"#.#", "#.#", "###", "..#", "..#"}, // 4
+    {"###", "#..", "###", "..#", "###"}, // 5
+    {"###", "#..", "###", "#.#", "###"}, // 6
+    {"###", "..#", "..#", "..#", "..#"}, // 7
+    {"###", "#.#", "###", "#.#", "###"}, // 8
+    {"###", "#.#", "###", "..#", "###"}, // 9
+    {"...", ".#.", "###", ".#.", "..."}  // +
+};
+
+static const float BURST_SPEED_MIN = 150.0f;
+static const float BURST_SPEED_MAX = 450.0f;
+static const float BURST_GRAVITY = 900.0f;
+static const float POPUP_CELL = 8.0f;
+static const float POPUP_RISE_SPEED = -90.0f;
+static const float POPUP_LIFETIME = 0.9f;
+
+static float randomRange(float minValue, float maxValue)
+{
+    return minValue + (float)rand() / (float)RAND_MAX * (maxValue - minValue);
+}
+
+ParticleSystem::ParticleSystem(size_t maxParticles)
+    : capacity(maxParticles),
+      liveCount(0),
+      posX(maxParticles), posY(maxParticles),
+      velX(maxParticles), velY(maxParticles),
+      accelY(maxParticles),
+      life(maxParticles), invMaxLife(maxParticles),
+      halfSize(maxParticles),
+      color(maxParticles),
+      vertices(sf::Quads, maxParticles * 4)
+{
+}
+
+bool ParticleSystem::spawn(float x, float y, float vx, float vy, float ay,
+                           float lifetime, float size, const sf::Color& c)
+{
+    // Pool cheio: o efeito é descartado em vez de alocar.
+    if (liveCount == capacity) return false;
+
+    size_t i = liveCount++;
+    posX[i] = x;
+    posY[i] = y;
+    velX[i] = vx;
+    velY[i] = vy;
+    accelY[i] = ay;
+    life[i] = lifetime;
+    invMaxLife[i] = 1.0f / lifetime;
+    halfSize[i] = size / 2.0f;
+    color[i] = c;
+    return true;
+}
+
+void ParticleSystem::emitBurst(const sf::Vector2f& center, int count)
+{
+    static const sf::Color palette[] = {
+        sf::Color(139, 90, 43),   // marrom da capivara
+        sf::Color(205, 133, 63),  // caramelo
+        sf::Color(255, 215, 0),   // dourado
+        sf::Color::White
+    };
+
+    for (int n = 0; n < count; ++n) {
+        float angle = randomRange(0.0f, 6.2831853f);
+        float speed = randomRange(BURST_SPEED_MIN, BURST_SPEED_MAX);
+        if (!spawn(center.x, center.y,
+                   cos(angle) * speed, sin(angle) * speed - 200.0f, BURST_GRAVITY,
+                   randomRange(0.4f, 0.8f), randomRange(4.0f, 10.0f),
+                   palette[rand() % 4])) {
+            return;
+        }
+    }
+}
+
+void ParticleSystem::emitScorePopup(const sf::Vector2f& center, int points)
+{
+    string label = "+" + to_string(points);
+    float width = label.size() * 4.0f * POPUP_CELL - POPUP_CELL;
+    float left = center.x - width / 2.0f;
+    float top = center.y - 2.5f * POPUP_CELL;
+
+    for (size_t c = 0; c < label.size(); ++c) {
+        int glyph = (label[c] == '+') ? 10 : label[c] - '0';
+        float glyphLeft = left + c * 4.0f * POPUP_CELL;
+
+        for (int row = 0; row < 5; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                if (BLOCK_GLYPHS[glyph][row][col] != '#') continue;
+
+                if (!spawn(glyphLeft + (col + 0.5f) * POPUP_CELL, top + (row + 0.5f) * POPUP_CELL,
+                           0.0f, POPUP_RISE_SPEED, 0.0f,
+                           POPUP_LIFETIME, POPUP_CELL, sf::Color(255, 215, 0))) {
+                    return;
+                }
+            }
+        }
+    }
+}
+
+// Integração: loop único, sem desvios, vetorizado com -O3. Os ponteiros
+// são parâmetros __restrict (cada um é um vetor diferente): sem isso o
+// compilador precisa supor que se sobrepõem e não vetoriza. O GCC ignora
+// __restrict em variáveis locais, por isso a função separada.
+static void integrate(size_t n, float dt,
+                      float* __restrict px, float* __restrict py,
+                      const float* __restrict vx, float* __restrict vy,
+                      const float* __restrict ay, float* __restrict lf)
+{
+    for (size_t i = 0; i < n; ++i) {
+        vy[i] += ay[i] * dt;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        lf[i] -= dt;
+    }
+}
+
+void ParticleSystem::update(float dt)
+{
+    integrate(liveCount, dt, posX.data(), posY.data(), velX.data(), velY.data(),
+              accelY.data(), life.data());
+
+    // Remove as mortas trocando com a última viva (ordem não importa).
+    size_t i = 0;
+    while (i < liveCount) {
+        if (life[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+
+        size_t last = --liveCount;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        accelY[i] = accelY[last];
+        life[i] = life[last];
+        invMaxLife[i] = invMaxLife[last];
+        halfSize[i] = halfSize[last];
+        color[i] = color[last];
+    }
+
+    buildVertices();
+}
+
+void ParticleSystem::clear()
+{
+    liveCount = 0;
+}
+
+void ParticleSystem::buildVertices()
+{
+    for (size_t i = 0; i < liveCount; ++i) {
+        float h = halfSize[i];
+        float x = posX[i];
+        float y = posY[i];
+
+        sf::Color c = color[i];
+        c.a = static_cast<sf::Uint8>(255.0f * min(1.0f, life[i] * invMaxLife[i]));
+
+        sf::Vertex* quad = &vertices[i * 4];
+        quad[0].position = sf::Vector2f(x - h, y - h);
+        quad[1].position = sf::Vector2f(x + h, y - h);
+        quad[2].position = sf::Vector2f(x + h, y + h);
+        quad[3].position = sf::Vector2f(x - h, y + h);
+        quad[0].color = c;
+        quad[1].color = c;
+        quad[2].color = c;
+        quad[3].color = c;
+    }
+}
+
+void ParticleSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (liveCount == 0) return;
+
+    // Uma única chamada de desenho, só com os quads vivos.
+    target.draw(&vertices[0], liveCount * 4, sf::Quads, states);
+}
@@ -0,0 +1,52 @@
+#ifndef PARTICLE_SYSTEM_HPP
+#define PARTICLE_SYSTEM_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+// =======================================================
+// SISTEMA DE PARTÍCULAS (EFEITOS DE ACERTO)
+// =======================================================
+// Pool de capacidade fixa: toda a memória é reservada no construtor e
+// nenhum efeito aloca durante o jogo. As partículas ficam em SoA (um vetor
+// por campo) e as vivas são sempre os primeiros liveCount elementos, para
+// o update ser um único loop contínuo. O desenho é uma única chamada
+// com os quads do sf::VertexArray.
+class ParticleSystem : public sf::Drawable {
+public:
+    explicit ParticleSystem(std::size_t maxParticles);
+
+    // Explosão de partículas no ponto do acerto.
+    void emitBurst(const sf::Vector2f& center, int count);
+
+    // Texto "+N" em blocos que sobe e desaparece.
+    void emitScorePopup(const sf::Vector2f& center, int points);
+
+    void update(float dt);
+    void clear();
+
+    std::size_t getLiveCount() const { return liveCount; }
+    std::size_t getCapacity() const { return capacity; }
+
+private:
+    std::size_t capacity;
+    std::size_t liveCount;
+
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> accelY;
+    std::vector<float> life, invMaxLife;
+    std::vector<float> halfSize;
+    std::vector<sf::Color> color;
+
+    sf::VertexArray vertices;
+
+    bool spawn(float x, float y, float vx, float vy, float ay,
+               float lifetime, float size, const sf::Color& c);
+    void buildVertices();
+
+    virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+};
+
+#endif // PARTICLE_SYSTEM_HPP
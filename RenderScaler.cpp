@@ -0,0 +1,153 @@
+#include "RenderScaler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace std;
+
+// Faixa da escala da resolução interna.
+static const float MIN_SCALE = 0.5f;
+static const float MAX_SCALE = 1.0f;
+
+// Histerese da resolução dinâmica: desce rápido, sobe devagar.
+static const float MISSED_DEADLINE_RATIO = 1.05f;
+static const float UNDER_BUDGET_RATIO = 0.60f;
+static const int FRAMES_BEFORE_DOWNSCALE = 30;
+static const int FRAMES_BEFORE_UPSCALE = 180;
+static const float DOWNSCALE_STEP = 0.10f;
+static const float UPSCALE_STEP = 0.05f;
+
+RenderScaler::RenderScaler(float logicalWidth, float logicalHeight)
+    : logicalSize(logicalWidth, logicalHeight),
+      letterboxView(sf::FloatRect(0.0f, 0.0f, logicalWidth, logicalHeight)),
+      internalView(sf::FloatRect(0.0f, 0.0f, logicalWidth, logicalHeight)),
+      scale(MAX_SCALE),
+      dynamicEnabled(true),
+      averageFrameMs(0.0f),
+      averageWorkMs(0.0f),
+      framesOverBudget(0),
+      framesUnderBudget(0)
+{
+}
+
+bool RenderScaler::create(unsigned internalWidth, unsigned internalHeight)
+{
+    unsigned maxSize = sf::Texture::getMaximumSize();
+    internalWidth = min(internalWidth, maxSize);
+    internalHeight = min(internalHeight, maxSize);
+
+    if (!target.create(internalWidth, internalHeight)) {
+        return false;
+    }
+    target.setSmooth(true);
+    frameSprite.setTexture(target.getTexture(), true);
+
+    scale = MAX_SCALE;
+    applyScale();
+    return true;
+}
+
+void RenderScaler::updateLetterbox(sf::RenderWindow& window)
+{
+    sf::Vector2u windowSize = window.getSize();
+    if (windowSize.x == 0 || windowSize.y == 0) return;
+
+    float windowRatio = static_cast<float>(windowSize.x) / windowSize.y;
+    float logicalRatio = logicalSize.x / logicalSize.y;
+
+    sf::FloatRect viewport(0.0f, 0.0f, 1.0f, 1.0f);
+    if (windowRatio > logicalRatio) {
+        viewport.width = logicalRatio / windowRatio;
+        viewport.left = (1.0f - viewport.width) / 2.0f;
+    } else {
+        viewport.height = windowRatio / logicalRatio;
+        viewport.top = (1.0f - viewport.height) / 2.0f;
+    }
+
+    letterboxView.setViewport(viewport);
+    window.setView(letterboxView);
+}
+
+sf::RenderTarget& RenderScaler::beginFrame(const sf::Color& clearColor)
+{
+    target.setView(internalView);
+    target.clear(clearColor);
+    return target;
+}
+
+void RenderScaler::present(sf::RenderWindow& window)
+{
+    target.display();
+
+    window.clear(sf::Color::Black);
+    window.setView(letterboxView);
+    window.draw(frameSprite);
+}
+
+void RenderScaler::adapt(float frameMs, float workMs, float budgetMs)
+{
+    if (!dynamicEnabled || budgetMs <= 0.0f) return;
+
+    // Médias móveis para não reagir a um único quadro lento.
+    averageFrameMs = averageFrameMs * 0.9f + frameMs * 0.1f;
+    averageWorkMs = averageWorkMs * 0.9f + workMs * 0.1f;
+
+    // Desce pelo tempo de quadro: com a GPU no limite, o atraso aparece
+    // no display() e não no tempo de trabalho. Com ritmo fixo o quadro
+    // dura o período, então só passa do orçamento quando perde o prazo.
+    if (averageFrameMs > budgetMs * MISSED_DEADLINE_RATIO) {
+        framesUnderBudget = 0;
+        if (++framesOverBudget >= FRAMES_BEFORE_DOWNSCALE && scale > MIN_SCALE) {
+            scale = max(MIN_SCALE, scale - DOWNSCALE_STEP);
+            framesOverBudget = 0;
+            applyScale();
+        }
+    }
+    // Sobe só com os prazos em dia e folga no trabalho do quadro
+    else if (averageWorkMs < budgetMs * UNDER_BUDGET_RATIO) {
+        framesOverBudget = 0;
+        if (++framesUnderBudget >= FRAMES_BEFORE_UPSCALE && scale < MAX_SCALE) {
+            scale = min(MAX_SCALE, scale + UPSCALE_STEP);
+            framesUnderBudget = 0;
+            applyScale();
+        }
+    }
+    else {
+        framesOverBudget = 0;
+        framesUnderBudget = 0;
+    }
+}
+
+void RenderScaler::setDynamicEnabled(bool enabled)
+{
+    dynamicEnabled = enabled;
+    if (!dynamicEnabled && scale != MAX_SCALE) {
+        scale = MAX_SCALE;
+        applyScale();
+    }
+}
+
+sf::Vector2u RenderScaler::getCurrentSize() const
+{
+    sf::Vector2u textureSize = target.getSize();
+    return sf::Vector2u(max(1u, static_cast<unsigned>(lround(textureSize.x * scale))),
+                        max(1u, static_cast<unsigned>(lround(textureSize.y * scale))));
+}
+
+void RenderScaler::applyScale()
+{
+    sf::Vector2u textureSize = target.getSize();
+    sf::Vector2u currentSize = getCurrentSize();
+
+    // Desenha só no canto superior esquerdo da textura...
+    internalView.setViewport(sf::FloatRect(0.0f, 0.0f,
+                                           static_cast<float>(currentSize.x) / textureSize.x,
+                                           static_cast<float>(currentSize.y) / textureSize.y));
+
+    // ...e estica apenas essa região até o tamanho lógico na janela.
+    frameSprite.setTextureRect(sf::IntRect(0, 0, currentSize.x, currentSize.y));
+    frameSprite.setScale(logicalSize.x / currentSize.x, logicalSize.y / currentSize.y);
+
+    cout << "Resolucao interna: " << currentSize.x << "x" << currentSize.y
+         << " (escala " << scale << ")" << endl;
+}
@@ -0,0 +1,58 @@
+#ifndef RENDER_SCALER_HPP
+#define RENDER_SCALER_HPP
+
+#include <SFML/Graphics.hpp>
+
+// =======================================================
+// RENDERIZAÇÃO EM RESOLUÇÃO INTERNA
+// =======================================================
+// O jogo desenha num sf::RenderTexture usando sempre as coordenadas lógicas
+// (WINDOW_WIDTH x WINDOW_HEIGHT). A imagem é escalada para a janela com
+// barras pretas (letterbox), e a view da janela usa as mesmas coordenadas
+// lógicas, então window.mapPixelToCoords() continua valendo para os cliques.
+//
+// A resolução dinâmica usa só uma parte da textura (escala 0.5 a 1.0), para
+// nunca precisar recriar o RenderTexture no meio do jogo.
+class RenderScaler {
+public:
+    RenderScaler(float logicalWidth, float logicalHeight);
+
+    // Cria a textura na resolução interna máxima.
+    bool create(unsigned internalWidth, unsigned internalHeight);
+
+    // Recalcula as barras pretas para o tamanho atual da janela.
+    void updateLetterbox(sf::RenderWindow& window);
+
+    // Prepara e limpa o alvo offscreen para o quadro atual.
+    sf::RenderTarget& beginFrame(const sf::Color& clearColor);
+
+    // Copia o quadro offscreen escalado para a janela.
+    void present(sf::RenderWindow& window);
+
+    // Ajusta a escala conforme o tempo de quadro completo (inclui o
+    // display(), onde aparece a espera pela GPU) e o tempo de trabalho.
+    void adapt(float frameMs, float workMs, float budgetMs);
+
+    void setDynamicEnabled(bool enabled);
+    bool isDynamicEnabled() const { return dynamicEnabled; }
+    float getScale() const { return scale; }
+    sf::Vector2u getCurrentSize() const;
+
+private:
+    sf::Vector2f logicalSize;
+    sf::RenderTexture target;
+    sf::View letterboxView;
+    sf::View internalView;
+    sf::Sprite frameSprite;
+
+    float scale;
+    bool dynamicEnabled;
+    float averageFrameMs;
+    float averageWorkMs;
+    int framesOverBudget;
+    int framesUnderBudget;
+
+    void applyScale();
+};
+
+#endif // RENDER_SCALER_HPP
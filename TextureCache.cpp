@@ -0,0 +1,213 @@
+#include "TextureCache.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+
+static double toMegabytes(size_t bytes)
+{
+    return bytes / (1024.0 * 1024.0);
+}
+
+static bool loadTextureFile(const string& path, sf::Texture& texture, sf::Vector2u& size)
+{
+    if (!texture.loadFromFile(path)) return false;
+    size = texture.getSize();
+    return true;
+}
+
+TextureCache::TextureCache(size_t budgetBytes)
+    : loader(loadTextureFile),
+      budgetBytes(budgetBytes),
+      residentBytes(0),
+      useCounter(0),
+      loadCount(0),
+      evictionCount(0),
+      loadedThisFrame(false)
+{
+}
+
+void TextureCache::setBudget(size_t bytes)
+{
+    budgetBytes = bytes;
+    evictUntilFits(0, NULL, false);
+}
+
+const sf::Texture* TextureCache::acquire(const string& name)
+{
+    Entry& entry = entries[name];
+    if (!entry.resident && !load(name, entry)) {
+        return NULL;
+    }
+
+    entry.refCount++;
+    entry.lastUse = ++useCounter;
+    entry.prefetched = false;
+    evictUntilFits(0, NULL, false);
+    return &entry.texture;
+}
+
+void TextureCache::release(const string& name)
+{
+    map<string, Entry>::iterator it = entries.find(name);
+    if (it == entries.end() || it->second.refCount == 0) return;
+
+    it->second.refCount--;
+    evictUntilFits(0, NULL, false);
+}
+
+void TextureCache::prefetch(const string& name)
+{
+    map<string, Entry>::const_iterator it = entries.find(name);
+    if (it != entries.end() && it->second.resident) return;
+    if (find(prefetchQueue.begin(), prefetchQueue.end(), name) != prefetchQueue.end()) return;
+
+    prefetchQueue.push_back(name);
+}
+
+void TextureCache::clearPrefetch()
+{
+    prefetchQueue.clear();
+    for (map<string, Entry>::iterator it = entries.begin(); it != entries.end(); ++it) {
+        it->second.prefetched = false;
+    }
+}
+
+void TextureCache::update()
+{
+    // Um carregamento por quadro no máximo: o prefetch não pode virar
+    // um pico de tempo maior que a própria troca de tela.
+    if (loadedThisFrame) {
+        loadedThisFrame = false;
+        return;
+    }
+
+    while (!prefetchQueue.empty()) {
+        string name = prefetchQueue.front();
+        prefetchQueue.pop_front();
+
+        Entry& entry = entries[name];
+        if (entry.resident) continue;
+
+        // Tamanho já conhecido e sem espaço: desiste antes de carregar
+        if (entry.bytes > 0 && !evictUntilFits(entry.bytes, NULL, true)) {
+            cout << "Prefetch abandonado (sem espaço): " << name << endl;
+            continue;
+        }
+
+        if (load(name, entry)) {
+            // Conta como uso recente: é a textura esperada para a próxima tela
+            entry.lastUse = ++useCounter;
+            entry.prefetched = true;
+
+            // Primeiro carregamento (tamanho era desconhecido) e não coube:
+            // a própria textura antecipada é que sai
+            if (!evictUntilFits(0, &entry, true)) {
+                cout << "Prefetch abandonado (sem espaço): " << name << endl;
+                evict(entry);
+            }
+            loadedThisFrame = false;
+        }
+        return;
+    }
+}
+
+bool TextureCache::isResident(const string& name) const
+{
+    map<string, Entry>::const_iterator it = entries.find(name);
+    return it != entries.end() && it->second.resident;
+}
+
+size_t TextureCache::getResidentCount() const
+{
+    size_t count = 0;
+    for (map<string, Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+        if (it->second.resident) count++;
+    }
+    return count;
+}
+
+void TextureCache::printStats(ostream& out) const
+{
+    out << fixed << setprecision(1);
+    out << "Texturas residentes: " << getResidentCount() << " (" << toMegabytes(residentBytes)
+        << " MB de " << toMegabytes(budgetBytes) << " MB), " << loadCount << " carregamentos, "
+        << evictionCount << " descartes" << endl;
+    for (map<string, Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+        if (!it->second.resident) continue;
+        out << "  " << left << setw(20) << it->first << right << setw(7) << toMegabytes(it->second.bytes)
+            << " MB" << (it->second.refCount > 0 ? "  (em uso)" : "") << endl;
+    }
+    out.unsetf(ios::fixed);
+}
+
+bool TextureCache::load(const string& name, Entry& entry)
+{
+    string path = assetsDir.empty() ? name : assetsDir + "/" + name;
+    sf::Vector2u size;
+    if (!loader(path, entry.texture, size)) {
+        cout << "Erro ao carregar a textura " << path << endl;
+        return false;
+    }
+
+    entry.bytes = static_cast<size_t>(size.x) * size.y * 4;
+    entry.resident = true;
+    residentBytes += entry.bytes;
+    loadCount++;
+    loadedThisFrame = true;
+
+    cout << "Textura carregada: " << name << " (residentes: " << fixed << setprecision(1)
+         << toMegabytes(residentBytes) << " MB)" << endl;
+    cout.unsetf(ios::fixed);
+    return true;
+}
+
+void TextureCache::evict(Entry& entry)
+{
+    // Atribuir uma textura vazia libera a memória de vídeo; o objeto
+    // continua no mesmo endereço para os sprites que ainda o apontam.
+    entry.texture = sf::Texture();
+    entry.resident = false;
+    entry.prefetched = false;
+    residentBytes -= entry.bytes;
+    evictionCount++;
+}
+
+bool TextureCache::canEvict(const string& name, const Entry& entry, const Entry* keep, bool forPrefetch) const
+{
+    if (!entry.resident || entry.refCount > 0 || &entry == keep) return false;
+    if (!forPrefetch) return true;
+
+    // Um prefetch não desfaz outro: as texturas antecipadas são todas
+    // esperadas na próxima tela
+    return !entry.prefetched &&
+           find(prefetchQueue.begin(), prefetchQueue.end(), name) == prefetchQueue.end();
+}
+
+bool TextureCache::evictUntilFits(size_t extraBytes, const Entry* keep, bool forPrefetch)
+{
+    if (residentBytes + extraBytes <= budgetBytes) return true;
+
+    // Confere antes de descartar: se nem todas as descartáveis liberam o
+    // suficiente, não adianta jogar nenhuma fora. Com as presas acima do
+    // orçamento, ele fica excedido até um release.
+    size_t evictableBytes = 0;
+    for (map<string, Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+        if (canEvict(it->first, it->second, keep, forPrefetch)) evictableBytes += it->second.bytes;
+    }
+    if (residentBytes + extraBytes > budgetBytes + evictableBytes) return false;
+
+    while (residentBytes + extraBytes > budgetBytes) {
+        map<string, Entry>::iterator oldest = entries.end();
+        for (map<string, Entry>::iterator it = entries.begin(); it != entries.end(); ++it) {
+            if (!canEvict(it->first, it->second, keep, forPrefetch)) continue;
+            if (oldest == entries.end() || it->second.lastUse < oldest->second.lastUse) oldest = it;
+        }
+        if (oldest == entries.end()) return false;
+
+        cout << "Textura descartada: " << oldest->first << endl;
+        evict(oldest->second);
+    }
+    return true;
+}
@@ -0,0 +1,111 @@
+#ifndef TEXTURE_CACHE_HPP
+#define TEXTURE_CACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+
+// =======================================================
+// CACHE DE TEXTURAS (CARREGAMENTO SOB DEMANDA)
+// =======================================================
+// Texturas indexadas pelo nome do arquivo: cada arquivo é carregado uma
+// única vez, na primeira vez que é pedido. Texturas presas (acquire sem
+// release) nunca são descartadas; as soltas ficam residentes enquanto
+// couberem no orçamento de bytes e saem da menos usada recentemente para
+// a mais recente. Um prefetch nunca descarta outra textura antecipada que
+// ainda não foi usada nem uma que esteja na fila.
+class TextureCache : private sf::NonCopyable {
+public:
+    // 3 artes de tela de 1024x1024 RGBA
+    static const std::size_t DEFAULT_BUDGET_BYTES = 12 * 1024 * 1024;
+
+    // Lê o arquivo 'path' para 'texture' e informa o tamanho em pixels.
+    typedef std::function<bool(const std::string& path, sf::Texture& texture, sf::Vector2u& size)> Loader;
+
+    explicit TextureCache(std::size_t budgetBytes = DEFAULT_BUDGET_BYTES);
+
+    // Pasta dos arquivos (vazio = pasta atual).
+    void setAssetsDir(const std::string& dir) { assetsDir = dir; }
+
+    // Troca a leitura dos arquivos (o teste usa um carregador sem OpenGL).
+    // O padrão é sf::Texture::loadFromFile.
+    void setLoader(const Loader& newLoader) { loader = newLoader; }
+
+    // Ao reduzir o orçamento, descarta as texturas soltas que sobrarem.
+    void setBudget(std::size_t bytes);
+    std::size_t getBudget() const { return budgetBytes; }
+
+    // Carrega se preciso e prende a textura (contagem de referências).
+    // O endereço retornado não muda enquanto o cache existir.
+    // Retorna NULL se o arquivo não puder ser carregado.
+    const sf::Texture* acquire(const std::string& name);
+
+    // Solta uma referência; com zero referências a textura pode ser descartada.
+    void release(const std::string& name);
+
+    // Agenda o carregamento antecipado (sem prender) de uma textura que
+    // provavelmente será usada em breve.
+    void prefetch(const std::string& name);
+
+    // Esvazia a fila de prefetch e deixa as texturas antecipadas e ainda não
+    // usadas voltarem a ser descartáveis. Chamar ao trocar de tela, antes
+    // de agendar os prefetches da nova tela.
+    void clearPrefetch();
+
+    // Chamar uma vez por quadro: carrega no máximo uma textura da fila de
+    // prefetch, e nenhuma se o quadro já carregou alguma em acquire().
+    // Se a textura não couber, o prefetch é abandonado sem descartar nada.
+    void update();
+
+    bool isResident(const std::string& name) const;
+    std::size_t getResidentBytes() const { return residentBytes; }
+    std::size_t getResidentCount() const;
+    long long getLoadCount() const { return loadCount; }
+    long long getEvictionCount() const { return evictionCount; }
+
+    void printStats(std::ostream& out) const;
+
+private:
+    struct Entry {
+        sf::Texture texture;
+        std::size_t bytes;      // tamanho conhecido (mantido após o descarte)
+        int refCount;
+        unsigned long long lastUse;
+        bool resident;
+        bool prefetched;        // carregada por prefetch e ainda não usada
+
+        Entry() : bytes(0), refCount(0), lastUse(0), resident(false), prefetched(false) {}
+    };
+
+    std::string assetsDir;
+    Loader loader;
+    std::size_t budgetBytes;
+    std::size_t residentBytes;
+    unsigned long long useCounter;
+    long long loadCount;
+    long long evictionCount;
+    bool loadedThisFrame;
+
+    // std::map: os nós não mudam de lugar, então os sprites podem guardar
+    // o ponteiro da textura.
+    std::map<std::string, Entry> entries;
+    std::deque<std::string> prefetchQueue;
+
+    bool load(const std::string& name, Entry& entry);
+    void evict(Entry& entry);
+
+    // Textura solta que pode sair para dar lugar a outra. Para um prefetch,
+    // também ficam as antecipadas não usadas e as que estão na fila.
+    bool canEvict(const std::string& name, const Entry& entry, const Entry* keep, bool forPrefetch) const;
+
+    // Descarta texturas descartáveis (LRU) até que extraBytes caibam no
+    // orçamento. Nunca descarta 'keep'. Se nem todas juntas bastarem, não
+    // descarta nenhuma e retorna falso.
+    bool evictUntilFits(std::size_t extraBytes, const Entry* keep, bool forPrefetch);
+};
+
+#endif // TEXTURE_CACHE_HPP
@@ -0,0 +1,29 @@
+#ifndef TOOL_SUPPORT_HPP
+#define TOOL_SUPPORT_HPP
+
+#include <cstdlib>
+#include <streambuf>
+
+// =======================================================
+// APOIO ÀS FERRAMENTAS (BENCHMARK E TESTE GOLDEN)
+// =======================================================
+
+// Descarta o console do jogo (cout) enquanto a ferramenta roda: não mede a
+// escrita no terminal e não mistura as mensagens do jogo com o relatório.
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+// Falso quando não há servidor gráfico: no Linux, sem DISPLAY, o SFML
+// aborta ao criar um contexto OpenGL. Em CI, rode com xvfb-run.
+inline bool hasGraphicsDisplay()
+{
+#if defined(__linux__)
+    return std::getenv("DISPLAY") != NULL;
+#else
+    return true;
+#endif
+}
+
+#endif // TOOL_SUPPORT_HPP
@@ -0,0 +1,370 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "Game.hpp"
+#include "ToolSupport.hpp"
+
+using namespace std;
+
+// =======================================================
+// MICROBENCHMARKS DO NÚCLEO DO JOGO
+// =======================================================
+// Uso: capivara_bench [--filter=texto] [--out=arquivo.json]
+//                     [--baseline=anterior.json] [--threshold=10]
+//                     [--assets=pasta] [--min-time=0.5] [--no-gpu]
+//
+// O resultado sai em JSON (stdout ou --out). Com --baseline, cada medida é
+// comparada com a execução anterior e o programa retorna 1 se alguma ficar
+// mais lenta que o limite (em %).
+
+typedef chrono::steady_clock BenchClock;
+
+struct BenchResult {
+    string name;
+    long long iterations;
+    double medianNs;
+    double minNs;
+    double maxNs;
+};
+
+struct BenchOptions {
+    string filter;
+    string outPath;
+    string baselinePath;
+    string assetsDir = ".";
+    double thresholdPercent = 10.0;
+    double minTimeSeconds = 0.5;
+    bool gpu = true;
+};
+
+static volatile long long benchSink = 0;
+
+static const int SAMPLES = 7;
+
+// Roda fn(iterations) em amostras de tamanho calibrado e devolve ns por operação.
+template <typename Fn>
+static BenchResult runBenchmark(const string& name, const BenchOptions& options, long long opsPerIteration, Fn fn)
+{
+    // Calibração: dobra as iterações até uma amostra levar o tempo alvo.
+    double sampleSeconds = options.minTimeSeconds / SAMPLES;
+    long long iterations = 1;
+    for (;;) {
+        BenchClock::time_point start = BenchClock::now();
+        fn(iterations);
+        double elapsed = chrono::duration<double>(BenchClock::now() - start).count();
+        if (elapsed >= sampleSeconds || iterations >= (1LL << 40)) break;
+        iterations *= 2;
+    }
+
+    vector<double> samples;
+    for (int s = 0; s < SAMPLES; ++s) {
+        BenchClock::time_point start = BenchClock::now();
+        fn(iterations);
+        double elapsedNs = chrono::duration<double, nano>(BenchClock::now() - start).count();
+        samples.push_back(elapsedNs / (iterations * opsPerIteration));
+    }
+    sort(samples.begin(), samples.end());
+
+    BenchResult result;
+    result.name = name;
+    result.iterations = iterations * opsPerIteration;
+    result.medianNs = samples[SAMPLES / 2];
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+    return result;
+}
+
+static bool selected(const BenchOptions& options, const string& name)
+{
+    return options.filter.empty() || name.find(options.filter) != string::npos;
+}
+
+// =======================================================
+// SAÍDA E COMPARAÇÃO
+// =======================================================
+
+static void writeJson(ostream& out, const vector<BenchResult>& results)
+{
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+            << fixed << setprecision(3)
+            << ", \"median_ns\": " << r.medianNs
+            << ", \"min_ns\": " << r.minNs
+            << ", \"max_ns\": " << r.maxNs << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+        out.unsetf(ios::fixed);
+    }
+    out << "  ]\n}\n";
+}
+
+// Lê "name" e "median_ns" de um JSON gerado por writeJson.
+static map<string, double> readBaseline(const string& path)
+{
+    map<string, double> baseline;
+    ifstream in(path);
+    string line;
+    while (getline(in, line)) {
+        size_t namePos = line.find("\"name\": \"");
+        size_t medianPos = line.find("\"median_ns\": ");
+        if (namePos == string::npos || medianPos == string::npos) continue;
+
+        namePos += 9;
+        string name = line.substr(namePos, line.find('"', namePos) - namePos);
+        baseline[name] = strtod(line.c_str() + medianPos + 13, NULL);
+    }
+    return baseline;
+}
+
+static bool compareWithBaseline(ostream& report, const vector<BenchResult>& results,
+                                const map<string, double>& baseline, double thresholdPercent)
+{
+    bool regressed = false;
+    report << "\n=== Comparacao com a linha de base (limite " << thresholdPercent << "%) ===" << endl;
+    for (const BenchResult& r : results) {
+        map<string, double>::const_iterator it = baseline.find(r.name);
+        if (it == baseline.end() || it->second <= 0.0) {
+            report << left << setw(32) << r.name << right << "   (novo)" << endl;
+            continue;
+        }
+
+        double change = (r.medianNs - it->second) / it->second * 100.0;
+        bool slower = change > thresholdPercent;
+        regressed = regressed || slower;
+        report << left << setw(32) << r.name << right << fixed << setprecision(1)
+               << setw(8) << showpos << change << noshowpos << "%"
+               << (slower ? "  REGRESSAO" : "") << endl;
+        report.unsetf(ios::fixed);
+    }
+    return regressed;
+}
+
+// =======================================================
+// CENÁRIOS
+// =======================================================
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--filter=", 9) == 0)         options.filter = argv[i] + 9;
+        else if (strncmp(argv[i], "--out=", 6) == 0)       options.outPath = argv[i] + 6;
+        else if (strncmp(argv[i], "--baseline=", 11) == 0) options.baselinePath = argv[i] + 11;
+        else if (strncmp(argv[i], "--threshold=", 12) == 0) options.thresholdPercent = atof(argv[i] + 12);
+        else if (strncmp(argv[i], "--assets=", 9) == 0)    options.assetsDir = argv[i] + 9;
+        else if (strncmp(argv[i], "--min-time=", 11) == 0) options.minTimeSeconds = atof(argv[i] + 11);
+        else if (strcmp(argv[i], "--no-gpu") == 0)         options.gpu = false;
+        else {
+            cerr << "Opcao desconhecida: " << argv[i] << endl;
+            return 2;
+        }
+    }
+
+    if (options.gpu && !hasGraphicsDisplay()) {
+        cerr << "Aviso: sem DISPLAY, pulando os cenarios que usam GPU" << endl;
+        options.gpu = false;
+    }
+
+    NullBuffer nullBuffer;
+    streambuf* consoleBuffer = cout.rdbuf(&nullBuffer);
+    ostream report(cerr.rdbuf());
+
+    srand(12345);
+    vector<BenchResult> results;
+
+    // isCircleClicked: 4096 pontos contra o centro de um buraco.
+    if (selected(options, "isCircleClicked")) {
+        vector<sf::Vector2f> points(4096);
+        for (sf::Vector2f& p : points) {
+            p = sf::Vector2f((float)(rand() % 1024), (float)(rand() % 1024));
+        }
+        const sf::Vector2f center(528.0f, 588.0f);
+        results.push_back(runBenchmark("isCircleClicked", options, (long long)points.size(), [&](long long n) {
+            long long hits = 0;
+            for (long long it = 0; it < n; ++it) {
+                for (const sf::Vector2f& p : points) {
+                    hits += isCircleClicked(p, center, ClassicLayout::MOLE_RADIUS);
+                }
+            }
+            benchSink += hits;
+        }));
+    }
+
+    // Teste de clique com os baldes de cada layout (4096 pontos, todas as capivaras visíveis).
+    for (int layout = 0; layout < LAYOUT_COUNT; ++layout) {
+        currentLayout = static_cast<BoardLayoutId>(layout);
+        string name = string("isOverCapybara/") + boardLayoutName(currentLayout);
+        if (!selected(options, name)) continue;
+
+        startGame(normal);
+        for (Hole& hole : holes) hole.hasCapybara = true;
+        vector<sf::Vector2f> points(4096);
+        for (sf::Vector2f& p : points) {
+            p = sf::Vector2f((float)(rand() % 1024), (float)(rand() % 1024));
+        }
+        results.push_back(runBenchmark(name, options, (long long)points.size(), [&](long long n) {
+            long long hits = 0;
+            for (long long it = 0; it < n; ++it) {
+                for (const sf::Vector2f& p : points) {
+                    hits += isOverCapybara(p);
+                }
+            }
+            benchSink += hits;
+        }));
+    }
+    currentLayout = LAYOUT_CLASSIC;
+
+    // Loop de spawn/expiração das capivaras (um quadro por operação).
+    if (selected(options, "updateCapybaras")) {
+        startGame(hard);
+        results.push_back(runBenchmark("updateCapybaras", options, 1, [&](long long n) {
+            for (long long it = 0; it < n; ++it) {
+                updateCapybaras();
+            }
+        }));
+    }
+
+    // Atualização dos textos e da barra de tempo do HUD.
+    sf::Font font;
+    bool hasFont = options.gpu && font.loadFromFile(options.assetsDir + "/arial.ttf");
+    sf::Text scoreText("Pontos: 0", font, 40);
+    sf::Text timeText("Tempo: 60", font, 40);
+    sf::RectangleShape timeBar(sf::Vector2f(WINDOW_WIDTH - 100.0f, 30.0f));
+    scoreText.setPosition(50.0f, 50.0f);
+    timeText.setPosition(WINDOW_WIDTH - 250.0f, 50.0f);
+    timeBar.setPosition(50.0f, 10.0f);
+
+    if (selected(options, "updateHud")) {
+        startGame(normal);
+        results.push_back(runBenchmark("updateHud", options, 1, [&](long long n) {
+            for (long long it = 0; it < n; ++it) {
+                currentScore = static_cast<int>(it & 63);
+                updateHud(sf::milliseconds(static_cast<sf::Int32>(45000 - (it % 45000))), scoreText, timeText, timeBar);
+            }
+        }));
+    }
+
+    // Resolução de acerto de um clique (acerto e erro), sem OpenGL: roda
+    // também em CI sem DISPLAY.
+    if (selected(options, "resolveClick/hit")) {
+        startGame(normal);
+        results.push_back(runBenchmark("resolveClick/hit", options, 1, [&](long long n) {
+            for (long long it = 0; it < n; ++it) {
+                Hole& hole = holes[it % holes.size()];
+                hole.hasCapybara = true;
+                benchSink += resolveClick(hole.position);
+                hitEffects.clear();
+            }
+        }));
+    }
+
+    if (selected(options, "resolveClick/miss")) {
+        startGame(normal);
+        for (Hole& hole : holes) hole.hasCapybara = true;
+        const sf::Vector2f missPos(5.0f, 5.0f);
+        results.push_back(runBenchmark("resolveClick/miss", options, 1, [&](long long n) {
+            for (long long it = 0; it < n; ++it) {
+                benchSink += resolveClick(missPos);
+            }
+        }));
+    }
+
+    if (!options.gpu) {
+        report << "Cenarios com GPU desativados (DrawGame)" << endl;
+    } else {
+        sf::RenderTexture target;
+        if (!target.create(static_cast<unsigned>(WINDOW_WIDTH), static_cast<unsigned>(WINDOW_HEIGHT))) {
+            report << "Aviso: nao foi possivel criar o RenderTexture, pulando cenarios com GPU" << endl;
+        } else {
+            // DrawGame num alvo offscreen, com todas as capivaras visíveis.
+            sf::Texture gameTexture, moleTexture;
+            if (!gameTexture.loadFromFile(options.assetsDir + "/fundoGAME.png") ||
+                !moleTexture.loadFromFile(options.assetsDir + "/toupeira.png")) {
+                report << "Aviso: texturas nao encontradas em '" << options.assetsDir << "', pulando DrawGame" << endl;
+            } else {
+                if (!hasFont) {
+                    report << "Aviso: arial.ttf nao encontrada, DrawGame sem texto" << endl;
+                }
+                sf::Sprite gameSprite(gameTexture);
+                sf::Sprite moleSprite(moleTexture);
+                moleSprite.setOrigin(moleTexture.getSize().x / 2.0f, moleTexture.getSize().y / 2.0f);
+
+                startGame(normal);
+                for (Hole& hole : holes) hole.hasCapybara = true;
+
+                if (selected(options, "DrawGame")) {
+                    results.push_back(runBenchmark("DrawGame", options, 1, [&](long long n) {
+                        for (long long it = 0; it < n; ++it) {
+                            target.clear(sf::Color(100, 149, 237));
+                            DrawGame(target, gameSprite, moleSprite, scoreText, timeText, timeBar);
+                            target.display();
+                        }
+                    }));
+                }
+
+                // Mesmo quadro com o pool de partículas quase cheio.
+                if (selected(options, "DrawGame/particles")) {
+                    while (hitEffects.getLiveCount() + HIT_BURST_PARTICLES <= hitEffects.getCapacity()) {
+                        hitEffects.emitBurst(holes[hitEffects.getLiveCount() % holes.size()].position, HIT_BURST_PARTICLES);
+                    }
+                    hitEffects.update(0.0f);
+                    results.push_back(runBenchmark("DrawGame/particles", options, 1, [&](long long n) {
+                        for (long long it = 0; it < n; ++it) {
+                            target.clear(sf::Color(100, 149, 237));
+                            DrawGame(target, gameSprite, moleSprite, scoreText, timeText, timeBar);
+                            target.display();
+                        }
+                    }));
+                    hitEffects.clear();
+                }
+            }
+        }
+    }
+
+    cout.rdbuf(consoleBuffer);
+
+    // Tabela legível no stderr, JSON no stdout ou no arquivo.
+    report << "\n" << left << setw(32) << "cenario" << right << setw(14) << "mediana (ns)"
+           << setw(14) << "min (ns)" << setw(14) << "max (ns)" << endl;
+    for (const BenchResult& r : results) {
+        report << left << setw(32) << r.name << right << fixed << setprecision(2)
+               << setw(14) << r.medianNs << setw(14) << r.minNs << setw(14) << r.maxNs << endl;
+        report.unsetf(ios::fixed);
+    }
+
+    if (options.outPath.empty()) {
+        writeJson(cout, results);
+    } else {
+        ofstream out(options.outPath);
+        if (!out) {
+            cerr << "Erro ao escrever " << options.outPath << endl;
+            return 2;
+        }
+        writeJson(out, results);
+        report << "Resultados salvos em " << options.outPath << endl;
+    }
+
+    if (!options.baselinePath.empty()) {
+        map<string, double> baseline = readBaseline(options.baselinePath);
+        if (baseline.empty()) {
+            cerr << "Erro ao ler a linha de base " << options.baselinePath << endl;
+            return 2;
+        }
+        if (compareWithBaseline(report, results, baseline, options.thresholdPercent)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
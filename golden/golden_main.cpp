@@ -0,0 +1,272 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "Game.hpp"
+#include "ToolSupport.hpp"
+
+using namespace std;
+
+// =======================================================
+// TESTE VISUAL COM IMAGENS DE REFERÊNCIA (GOLDEN)
+// =======================================================
+// Desenha cada tela com um estado simulado num RenderTexture e compara com
+// as imagens de referência (<refs>/<cenario>.png).
+//
+// Uso: capivara_golden [--refs=pasta] [--update] [--tolerance=8]
+//                      [--max-diff=0.001] [--diff-dir=pasta]
+//                      [--assets=pasta] [--repeat=1] [--filter=texto]
+//
+// --update regrava as referências. Retorna 0 se tudo passou, 1 se alguma
+// tela mudou e 2 em erro (referência ausente, assets, contexto OpenGL).
+
+struct GoldenOptions {
+    string refsDir = "golden/reference";
+    string diffDir;
+    string assetsDir = ".";
+    string filter;
+    bool update = false;
+    int tolerance = 8;           // diferença máxima por canal (0-255)
+    double maxDiffFraction = 0.001; // fração máxima de pixels diferentes
+    int repeat = 1;
+};
+
+struct GoldenScenario {
+    string name;
+    GameState state;
+    function<void()> setup;
+    bool isBackgroundSoundMuted;
+    bool isClickSoundMuted;
+    FrameMode frameMode;
+};
+
+// Estado de jogo fixo: mesma semente, mesmas capivaras, mesmo tempo.
+static void simulateGame(BoardLayoutId layout, const DifficultySettings& difficulty,
+                         const vector<int>& visibleHoles, int score, float remainingSeconds,
+                         ScreenResources& screens)
+{
+    srand(42);
+    currentLayout = layout;
+    startGame(difficulty);
+    for (int i : visibleHoles) {
+        if (i < static_cast<int>(holes.size())) holes[i].hasCapybara = true;
+    }
+    currentScore = score;
+    updateHud(sf::seconds(remainingSeconds), screens.scoreText, screens.timeText, screens.timeBar);
+}
+
+static vector<GoldenScenario> buildScenarios(ScreenResources& screens)
+{
+    vector<GoldenScenario> scenarios;
+
+    scenarios.push_back({"menu", MENU, [] {}, false, false, FRAME_60HZ});
+
+    scenarios.push_back({"difficulty", DIFFICULTY_CHOICE, [] { currentLayout = LAYOUT_CLASSIC; },
+                         false, false, FRAME_60HZ});
+    scenarios.push_back({"difficulty_arena", DIFFICULTY_CHOICE, [] { currentLayout = LAYOUT_ARENA; },
+                         false, false, FRAME_60HZ});
+
+    scenarios.push_back({"playing_classic", PLAYING, [&screens] {
+        simulateGame(LAYOUT_CLASSIC, normal, {0, 2, 4, 6, 8}, 7, 30.0f, screens);
+    }, false, false, FRAME_60HZ});
+    scenarios.push_back({"playing_grid4x4", PLAYING, [&screens] {
+        simulateGame(LAYOUT_GRID_4X4, easy, {1, 6, 11, 12}, 3, 55.0f, screens);
+    }, false, false, FRAME_60HZ});
+    scenarios.push_back({"playing_grid5x5", PLAYING, [&screens] {
+        simulateGame(LAYOUT_GRID_5X5, hard, {0, 7, 12, 18, 24}, 15, 5.0f, screens);
+    }, false, false, FRAME_60HZ});
+    scenarios.push_back({"playing_arena", PLAYING, [&screens] {
+        simulateGame(LAYOUT_ARENA, normal, {0, 3, 9, 12}, 9, 20.0f, screens);
+    }, false, false, FRAME_60HZ});
+
+    scenarios.push_back({"playing_hit_effects", PLAYING, [&screens] {
+        simulateGame(LAYOUT_CLASSIC, normal, {4}, 1, 40.0f, screens);
+        hitEffects.emitBurst(holes[1].position, HIT_BURST_PARTICLES);
+        hitEffects.emitScorePopup(sf::Vector2f(holes[1].position.x, holes[1].position.y - boardMoleRadius(currentLayout)), 1);
+        hitEffects.update(0.2f);
+    }, false, false, FRAME_60HZ});
+
+    scenarios.push_back({"game_over", GAME_OVER, [&screens] {
+        simulateGame(LAYOUT_CLASSIC, hard, {}, 23, 0.0f, screens);
+        updateGameOverTexts(screens);
+    }, false, false, FRAME_60HZ});
+
+    scenarios.push_back({"options", OPTIONS_MENU, [] {}, false, false, FRAME_60HZ});
+    scenarios.push_back({"options_muted", OPTIONS_MENU, [] {}, true, true, FRAME_144HZ});
+
+    scenarios.push_back({"tutorial", TUTORIAL, [] {}, false, false, FRAME_60HZ});
+
+    return scenarios;
+}
+
+// Conta os pixels com algum canal fora da tolerância e marca-os em vermelho
+// na imagem de diferença.
+static long long compareImages(const sf::Image& actual, const sf::Image& reference, int tolerance, sf::Image& diff)
+{
+    sf::Vector2u size = actual.getSize();
+    diff.create(size.x, size.y, sf::Color::Black);
+
+    const sf::Uint8* a = actual.getPixelsPtr();
+    const sf::Uint8* r = reference.getPixelsPtr();
+    long long differing = 0;
+
+    for (unsigned y = 0; y < size.y; ++y) {
+        for (unsigned x = 0; x < size.x; ++x) {
+            size_t p = (static_cast<size_t>(y) * size.x + x) * 4;
+            int worst = 0;
+            for (int ch = 0; ch < 4; ++ch) {
+                worst = max(worst, abs(static_cast<int>(a[p + ch]) - static_cast<int>(r[p + ch])));
+            }
+
+            if (worst > tolerance) {
+                differing++;
+                diff.setPixel(x, y, sf::Color::Red);
+            } else {
+                sf::Uint8 gray = static_cast<sf::Uint8>((a[p] + a[p + 1] + a[p + 2]) / 6);
+                diff.setPixel(x, y, sf::Color(gray, gray, gray));
+            }
+        }
+    }
+    return differing;
+}
+
+int main(int argc, char* argv[])
+{
+    GoldenOptions options;
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--refs=", 7) == 0)           options.refsDir = argv[i] + 7;
+        else if (strncmp(argv[i], "--diff-dir=", 11) == 0) options.diffDir = argv[i] + 11;
+        else if (strncmp(argv[i], "--assets=", 9) == 0)    options.assetsDir = argv[i] + 9;
+        else if (strncmp(argv[i], "--filter=", 9) == 0)    options.filter = argv[i] + 9;
+        else if (strncmp(argv[i], "--tolerance=", 12) == 0) options.tolerance = atoi(argv[i] + 12);
+        else if (strncmp(argv[i], "--max-diff=", 11) == 0) options.maxDiffFraction = atof(argv[i] + 11);
+        else if (strncmp(argv[i], "--repeat=", 9) == 0)    options.repeat = max(1, atoi(argv[i] + 9));
+        else if (strcmp(argv[i], "--update") == 0)         options.update = true;
+        else {
+            cerr << "Opcao desconhecida: " << argv[i] << endl;
+            return 2;
+        }
+    }
+
+    if (!hasGraphicsDisplay()) {
+        cerr << "Erro: sem DISPLAY para criar o contexto OpenGL (use xvfb-run)" << endl;
+        return 2;
+    }
+
+    NullBuffer nullBuffer;
+    streambuf* consoleBuffer = cout.rdbuf(&nullBuffer);
+    ostream report(consoleBuffer);
+
+    ScreenResources screens;
+    if (!loadScreenResources(screens, options.assetsDir)) {
+        cout.rdbuf(consoleBuffer);
+        cerr << "Erro ao carregar os assets de '" << options.assetsDir << "'" << endl;
+        return 2;
+    }
+
+    sf::RenderTexture target;
+    if (!target.create(static_cast<unsigned>(WINDOW_WIDTH), static_cast<unsigned>(WINDOW_HEIGHT))) {
+        cout.rdbuf(consoleBuffer);
+        cerr << "Erro ao criar o RenderTexture" << endl;
+        return 2;
+    }
+
+    vector<GoldenScenario> scenarios = buildScenarios(screens);
+
+    int failures = 0;
+    int errors = 0;
+    long long framesRendered = 0;
+    double renderSeconds = 0.0;
+
+    for (const GoldenScenario& scenario : scenarios) {
+        if (!options.filter.empty() && scenario.name.find(options.filter) == string::npos) continue;
+
+        scenario.setup();
+
+        // Quadro de aquecimento fora da medida: o primeiro DrawScreen da
+        // tela carrega os PNGs pelo TextureCache.
+        target.clear(sf::Color(100, 149, 237));
+        DrawScreen(target, scenario.state, screens,
+                   scenario.isBackgroundSoundMuted, scenario.isClickSoundMuted, scenario.frameMode);
+        target.display();
+
+        // Renderiza o mesmo quadro --repeat vezes (medida de vazão); só o
+        // último é lido de volta da GPU, depois de parar o relógio.
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (int r = 0; r < options.repeat; ++r) {
+            target.clear(sf::Color(100, 149, 237));
+            DrawScreen(target, scenario.state, screens,
+                       scenario.isBackgroundSoundMuted, scenario.isClickSoundMuted, scenario.frameMode);
+            target.display();
+        }
+        renderSeconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        framesRendered += options.repeat;
+
+        sf::Image actual = target.getTexture().copyToImage();
+
+        string refPath = options.refsDir + "/" + scenario.name + ".png";
+        report << left << setw(24) << scenario.name << right;
+
+        if (options.update) {
+            if (actual.saveToFile(refPath)) {
+                report << "ATUALIZADA" << endl;
+            } else {
+                report << "ERRO ao salvar " << refPath << endl;
+                errors++;
+            }
+            continue;
+        }
+
+        sf::Image reference;
+        if (!reference.loadFromFile(refPath)) {
+            report << "SEM REFERENCIA (" << refPath << ")" << endl;
+            errors++;
+            continue;
+        }
+        if (reference.getSize() != actual.getSize()) {
+            report << "FALHOU: tamanho " << reference.getSize().x << "x" << reference.getSize().y << " na referencia" << endl;
+            failures++;
+            continue;
+        }
+
+        sf::Image diff;
+        long long differing = compareImages(actual, reference, options.tolerance, diff);
+        double fraction = static_cast<double>(differing) / (static_cast<double>(actual.getSize().x) * actual.getSize().y);
+
+        if (fraction <= options.maxDiffFraction) {
+            report << "OK     (" << differing << " pixels diferentes)" << endl;
+        } else {
+            report << "FALHOU (" << differing << " pixels diferentes, " << fixed << setprecision(3)
+                   << fraction * 100.0 << "%)" << endl;
+            report.unsetf(ios::fixed);
+            failures++;
+
+            if (!options.diffDir.empty()) {
+                actual.saveToFile(options.diffDir + "/" + scenario.name + "_actual.png");
+                diff.saveToFile(options.diffDir + "/" + scenario.name + "_diff.png");
+            }
+        }
+    }
+
+    cout.rdbuf(consoleBuffer);
+
+    if (renderSeconds > 0.0) {
+        cout << framesRendered << " quadros em " << fixed << setprecision(3) << renderSeconds << " s ("
+             << setprecision(0) << framesRendered / renderSeconds << " quadros/s)" << endl;
+        cout.unsetf(ios::fixed);
+    }
+
+    if (errors > 0) return 2;
+    if (failures > 0) {
+        cout << failures << " tela(s) diferente(s) da referencia" << endl;
+        return 1;
+    }
+    return 0;
+}
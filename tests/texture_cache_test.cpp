@@ -0,0 +1,199 @@
+#include <SFML/Graphics.hpp>
+#include <iostream>
+#include <map>
+#include <string>
+#include "TextureCache.hpp"
+#include "ToolSupport.hpp"
+
+using namespace std;
+
+// =======================================================
+// TESTE DO CACHE DE TEXTURAS
+// =======================================================
+// Roda sem janela: o carregador do cache é trocado por um falso que só
+// informa o tamanho da imagem, sem criar textura na GPU. Retorna 1 se
+// alguma verificação falhar.
+
+// Arte de tela de 1024x1024 RGBA
+const size_t SCREEN_BYTES = 1024 * 1024 * 4;
+
+static map<string, int> loadsByName;
+static int failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            cerr << __FILE__ << ":" << __LINE__ << ": falhou: " << #condition << endl; \
+            failures++; \
+        } \
+    } while (0)
+
+// "grande.png" tem o dobro de uma tela; "ausente.png" não existe
+static bool fakeLoad(const string& path, sf::Texture&, sf::Vector2u& size)
+{
+    if (path == "ausente.png") return false;
+    loadsByName[path]++;
+    size = path == "grande.png" ? sf::Vector2u(2048, 1024) : sf::Vector2u(1024, 1024);
+    return true;
+}
+
+static void makeCache(TextureCache& cache)
+{
+    loadsByName.clear();
+    cache.setLoader(fakeLoad);
+}
+
+static void touch(TextureCache& cache, const string& name)
+{
+    cache.acquire(name);
+    cache.release(name);
+}
+
+static void runFrames(TextureCache& cache, int frames)
+{
+    for (int i = 0; i < frames; ++i) cache.update();
+}
+
+static void testLruOrder()
+{
+    TextureCache cache(2 * SCREEN_BYTES);
+    makeCache(cache);
+
+    touch(cache, "a.png");
+    touch(cache, "b.png");
+    touch(cache, "a.png");   // a passa a ser a mais recente
+    touch(cache, "c.png");   // não cabe: sai a menos usada (b)
+
+    CHECK(cache.isResident("a.png"));
+    CHECK(!cache.isResident("b.png"));
+    CHECK(cache.isResident("c.png"));
+    CHECK(cache.getEvictionCount() == 1);
+    CHECK(loadsByName["a.png"] == 1);
+
+    touch(cache, "b.png");   // volta a carregar; sai a (agora a mais antiga)
+    CHECK(loadsByName["b.png"] == 2);
+    CHECK(!cache.isResident("a.png"));
+    CHECK(cache.isResident("c.png"));
+}
+
+static void testRefCount()
+{
+    TextureCache cache(SCREEN_BYTES);
+    makeCache(cache);
+
+    const sf::Texture* first = cache.acquire("a.png");
+    const sf::Texture* second = cache.acquire("a.png");
+    CHECK(first != NULL && first == second);
+    CHECK(loadsByName["a.png"] == 1);
+
+    // Ainda presa por uma referência: o orçamento fica excedido
+    cache.release("a.png");
+    cache.acquire("b.png");
+    CHECK(cache.isResident("a.png"));
+    CHECK(cache.isResident("b.png"));
+    CHECK(cache.getResidentBytes() == 2 * SCREEN_BYTES);
+
+    // Última referência solta: a sai e o cache volta ao orçamento
+    cache.release("a.png");
+    CHECK(!cache.isResident("a.png"));
+    CHECK(cache.isResident("b.png"));
+    CHECK(cache.getResidentBytes() == SCREEN_BYTES);
+
+    // Release a mais não deixa a contagem negativa
+    cache.release("a.png");
+    cache.release("b.png");
+    cache.release("b.png");
+    touch(cache, "c.png");
+    CHECK(!cache.isResident("b.png"));
+
+    CHECK(cache.acquire("ausente.png") == NULL);
+}
+
+static void testBudget()
+{
+    TextureCache cache(100 * SCREEN_BYTES);
+    makeCache(cache);
+
+    touch(cache, "grande.png");
+    touch(cache, "a.png");
+    cache.acquire("tela1.png");
+    cache.acquire("tela2.png");
+    CHECK(cache.getResidentBytes() == 5 * SCREEN_BYTES);
+
+    // Reduzir o orçamento descarta só o necessário, da menos recente
+    cache.setBudget(3 * SCREEN_BYTES + SCREEN_BYTES / 2);
+    CHECK(!cache.isResident("grande.png"));
+    CHECK(cache.isResident("a.png"));
+    CHECK(cache.getResidentBytes() == 3 * SCREEN_BYTES);
+
+    // grande.png (tamanho conhecido) não cabe nem descartando a.png: o
+    // prefetch é abandonado sem descartar nada
+    long long evictions = cache.getEvictionCount();
+    cache.prefetch("grande.png");
+    runFrames(cache, 3);
+    CHECK(!cache.isResident("grande.png"));
+    CHECK(cache.isResident("a.png"));
+    CHECK(cache.getEvictionCount() == evictions);
+    CHECK(loadsByName["grande.png"] == 1);
+
+    // Presas acima do orçamento: as soltas também ficam até um release
+    cache.setBudget(SCREEN_BYTES);
+    CHECK(cache.isResident("a.png"));
+    cache.release("tela1.png");
+    cache.release("tela2.png");
+    CHECK(cache.getResidentBytes() <= SCREEN_BYTES);
+}
+
+static void testPrefetch()
+{
+    TextureCache cache(2 * SCREEN_BYTES);
+    makeCache(cache);
+
+    // Tela de dificuldade presa, com o jogo antecipado: fundo e toupeira
+    cache.acquire("escolha.png");
+    cache.prefetch("fundo.png");
+    cache.prefetch("toupeira.png");
+
+    // O quadro do acquire já carregou: nada de prefetch nele
+    cache.update();
+    CHECK(!cache.isResident("fundo.png"));
+
+    runFrames(cache, 3);
+    CHECK(cache.isResident("fundo.png"));
+    // toupeira não coube e não pode descartar o fundo antecipado
+    CHECK(!cache.isResident("toupeira.png"));
+    CHECK(loadsByName["toupeira.png"] == 1);
+
+    // Acquire da textura antecipada não carrega de novo
+    cache.acquire("fundo.png");
+    CHECK(loadsByName["fundo.png"] == 1);
+    cache.release("fundo.png");
+
+    // Depois de clearPrefetch (troca de tela), o fundo volta a ser
+    // descartável por um novo prefetch
+    cache.clearPrefetch();
+    cache.prefetch("toupeira.png");
+    runFrames(cache, 2);
+    CHECK(cache.isResident("toupeira.png"));
+    CHECK(!cache.isResident("fundo.png"));
+    CHECK(cache.isResident("escolha.png"));
+}
+
+int main()
+{
+    NullBuffer nullBuffer;
+    streambuf* consoleBuffer = cout.rdbuf(&nullBuffer);
+
+    testLruOrder();
+    testRefCount();
+    testBudget();
+    testPrefetch();
+
+    cout.rdbuf(consoleBuffer);
+    if (failures > 0) {
+        cout << failures << " verificações falharam" << endl;
+        return 1;
+    }
+    cout << "Cache de texturas: OK" << endl;
+    return 0;
+}